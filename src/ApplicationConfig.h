@@ -25,9 +25,9 @@ struct ApplicationConfig {
   char city[100];
   char countryCode[3];
   char imageUrl[300];
-  float latitude;
-  float longitude;
-  int currentScreenIndex;
+  char llmBaseUrl[128];
+  char llmModel[64];
+  uint16_t llmTimeoutSeconds;
 
   ApplicationConfig() {
     memset(wifiSSID, 0, sizeof(wifiSSID));
@@ -37,6 +37,8 @@ struct ApplicationConfig {
     memset(city, 0, sizeof(city));
     memset(countryCode, 0, sizeof(countryCode));
     memset(imageUrl, 0, sizeof(imageUrl));
+    memset(llmBaseUrl, 0, sizeof(llmBaseUrl));
+    memset(llmModel, 0, sizeof(llmModel));
 
     strncpy(wifiSSID, DEFAULT_WIFI_SSID, sizeof(wifiSSID) - 1);
     strncpy(wifiPassword, DEFAULT_WIFI_PASSWORD, sizeof(wifiPassword) - 1);
@@ -45,14 +47,16 @@ struct ApplicationConfig {
     strncpy(city, DEFAULT_CITY, sizeof(city) - 1);
     strncpy(countryCode, DEFAULT_COUNTRY_CODE, sizeof(countryCode) - 1);
     strncpy(imageUrl, DEFAULT_IMAGE_URL, sizeof(imageUrl) - 1);
-
-    latitude = DEFAULT_LATITUDE;
-    longitude = DEFAULT_LONGITUDE;
-
-    currentScreenIndex = CURRENT_WEATHER_SCREEN;
+    strncpy(llmBaseUrl, DEFAULT_LLM_BASE_URL, sizeof(llmBaseUrl) - 1);
+    strncpy(llmModel, DEFAULT_LLM_MODEL, sizeof(llmModel) - 1);
+    llmTimeoutSeconds = DEFAULT_LLM_TIMEOUT_SECONDS;
   }
 
   bool hasValidWiFiCredentials() const { return strlen(wifiSSID) > 0 && strlen(wifiPassword) > 0; }
 
   bool hasValidOpenaiApiKey() const { return strlen(openaiApiKey) > 0; }
+
+  bool usesSelfHostedLlm() const { return strcmp(llmBaseUrl, DEFAULT_LLM_BASE_URL) != 0; }
+
+  bool hasLlmEndpoint() const { return hasValidOpenaiApiKey() || usesSelfHostedLlm(); }
 };
\ No newline at end of file
@@ -1,23 +1,169 @@
 #include "ApplicationConfigStorage.h"
 
+#include <esp_attr.h>
 #include <nvs.h>
 #include <nvs_flash.h>
+#include <rom/crc.h>
+#include <stddef.h>
 
 const char* ApplicationConfigStorage::NVS_NAMESPACE = "weather_config";
-const char* ApplicationConfigStorage::CONFIG_KEY = "app_config";
+const char* ApplicationConfigStorage::SCHEMA_V1_CONFIG_KEY = "app_config";
+const char* ApplicationConfigStorage::SCHEMA_VERSION_KEY = "schema";
+const char* ApplicationConfigStorage::LLM_TIMEOUT_KEY = "llm_timeout";
+const char* ApplicationConfigStorage::GENERATION_KEY = "generation";
+const char* ApplicationConfigStorage::LATITUDE_KEY = "latitude";
+const char* ApplicationConfigStorage::LONGITUDE_KEY = "longitude";
+
+RTC_DATA_ATTR static ApplicationConfigMirror configMirror;
+
+struct StringSetting {
+  const char* key;
+  size_t offset;
+  size_t size;
+};
+
+static const StringSetting STRING_SETTINGS[] = {
+    {"wifi_ssid", offsetof(ApplicationConfig, wifiSSID), sizeof(ApplicationConfig::wifiSSID)},
+    {"wifi_password", offsetof(ApplicationConfig, wifiPassword), sizeof(ApplicationConfig::wifiPassword)},
+    {"openai_key", offsetof(ApplicationConfig, openaiApiKey), sizeof(ApplicationConfig::openaiApiKey)},
+    {"prompt_style", offsetof(ApplicationConfig, aiPromptStyle), sizeof(ApplicationConfig::aiPromptStyle)},
+    {"city", offsetof(ApplicationConfig, city), sizeof(ApplicationConfig::city)},
+    {"country_code", offsetof(ApplicationConfig, countryCode), sizeof(ApplicationConfig::countryCode)},
+    {"image_url", offsetof(ApplicationConfig, imageUrl), sizeof(ApplicationConfig::imageUrl)},
+    {"llm_base_url", offsetof(ApplicationConfig, llmBaseUrl), sizeof(ApplicationConfig::llmBaseUrl)},
+    {"llm_model", offsetof(ApplicationConfig, llmModel), sizeof(ApplicationConfig::llmModel)},
+};
+
+struct SchemaV1ApplicationConfig {
+  char wifiSSID[64];
+  char wifiPassword[64];
+  char openaiApiKey[200];
+  char aiPromptStyle[200];
+  char city[100];
+  char countryCode[3];
+  char imageUrl[300];
+  float latitude;
+  float longitude;
+  int currentScreenIndex;
+  char llmBaseUrl[128];
+  char llmModel[64];
+  uint16_t llmTimeoutSeconds;
+};
+
+static const size_t SCHEMA_V1_SIZE_WITHOUT_LLM_ENDPOINT = offsetof(SchemaV1ApplicationConfig, llmBaseUrl);
+
+static char* settingField(ApplicationConfig& config, const StringSetting& setting) {
+  return reinterpret_cast<char*>(&config) + setting.offset;
+}
+
+static const char* settingField(const ApplicationConfig& config, const StringSetting& setting) {
+  return reinterpret_cast<const char*>(&config) + setting.offset;
+}
+
+static void copyString(char* target, size_t targetSize, const char* source, size_t sourceSize) {
+  size_t length = strnlen(source, sourceSize);
+  if (length >= targetSize) {
+    length = targetSize - 1;
+  }
+  memcpy(target, source, length);
+  memset(target + length, 0, targetSize - length);
+}
+
+static esp_err_t setStringIfChanged(nvs_handle_t nvsHandle, const char* key, const char* value, int& changedCount) {
+  size_t storedLength = 0;
+  if (nvs_get_str(nvsHandle, key, nullptr, &storedLength) == ESP_OK && storedLength == strlen(value) + 1) {
+    std::unique_ptr<char[]> stored(new char[storedLength]);
+    if (nvs_get_str(nvsHandle, key, stored.get(), &storedLength) == ESP_OK && strcmp(stored.get(), value) == 0) {
+      return ESP_OK;
+    }
+  }
+
+  changedCount++;
+  return nvs_set_str(nvsHandle, key, value);
+}
+
+static esp_err_t setU16IfChanged(nvs_handle_t nvsHandle, const char* key, uint16_t value, int& changedCount) {
+  uint16_t stored;
+  if (nvs_get_u16(nvsHandle, key, &stored) == ESP_OK && stored == value) {
+    return ESP_OK;
+  }
+
+  changedCount++;
+  return nvs_set_u16(nvsHandle, key, value);
+}
+
+static esp_err_t setU8IfChanged(nvs_handle_t nvsHandle, const char* key, uint8_t value, int& changedCount) {
+  uint8_t stored;
+  if (nvs_get_u8(nvsHandle, key, &stored) == ESP_OK && stored == value) {
+    return ESP_OK;
+  }
+
+  changedCount++;
+  return nvs_set_u8(nvsHandle, key, value);
+}
+
+static esp_err_t setFloatIfChanged(nvs_handle_t nvsHandle, const char* key, float value, int& changedCount) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  uint32_t stored;
+  if (nvs_get_u32(nvsHandle, key, &stored) == ESP_OK && stored == bits) {
+    return ESP_OK;
+  }
+
+  changedCount++;
+  return nvs_set_u32(nvsHandle, key, bits);
+}
+
+static esp_err_t getFloat(nvs_handle_t nvsHandle, const char* key, float& value) {
+  uint32_t bits;
+  esp_err_t err = nvs_get_u32(nvsHandle, key, &bits);
+  if (err == ESP_OK) {
+    memcpy(&value, &bits, sizeof(value));
+  }
+  return err;
+}
+
+ApplicationConfigStorage::ApplicationConfigStorage() {}
+
+ApplicationConfigStorage::~ApplicationConfigStorage() {}
+
+void ApplicationConfigStorage::initializeNvs() {
+  static bool isInitialized = false;
+  if (isInitialized) {
+    return;
+  }
 
-ApplicationConfigStorage::ApplicationConfigStorage() {
   esp_err_t err = nvs_flash_init();
   if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
     ESP_ERROR_CHECK(nvs_flash_erase());
     err = nvs_flash_init();
   }
   ESP_ERROR_CHECK(err);
+  isInitialized = true;
 }
 
-ApplicationConfigStorage::~ApplicationConfigStorage() {}
+uint32_t ApplicationConfigStorage::mirrorChecksum(const ApplicationConfigMirror& mirror) {
+  uint8_t schemaVersion = SCHEMA_VERSION;
+  uint32_t checksum = crc32_le(0, &schemaVersion, sizeof(schemaVersion));
+  checksum = crc32_le(checksum, reinterpret_cast<const uint8_t*>(&mirror.generation), sizeof(mirror.generation));
+  return crc32_le(checksum, mirror.config, sizeof(mirror.config));
+}
+
+bool ApplicationConfigStorage::isMirrorValid(const ApplicationConfigMirror& mirror) {
+  return mirror.checksum == mirrorChecksum(mirror);
+}
+
+void ApplicationConfigStorage::storeMirror(ApplicationConfigMirror& mirror, const ApplicationConfig& config,
+                                           uint32_t generation) {
+  mirror.generation = generation;
+  memcpy(mirror.config, &config, sizeof(mirror.config));
+  mirror.checksum = mirrorChecksum(mirror);
+}
 
 bool ApplicationConfigStorage::save(const ApplicationConfig& config) {
+  initializeNvs();
+  memset(&configMirror, 0, sizeof(configMirror));
+
   nvs_handle_t nvsHandle;
   esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvsHandle);
   if (err != ESP_OK) {
@@ -25,13 +171,40 @@ bool ApplicationConfigStorage::save(const ApplicationConfig& config) {
     return false;
   }
 
-  err = nvs_set_blob(nvsHandle, CONFIG_KEY, &config, sizeof(ApplicationConfig));
+  int changedCount = 0;
+  for (const StringSetting& setting : STRING_SETTINGS) {
+    err = setStringIfChanged(nvsHandle, setting.key, settingField(config, setting), changedCount);
+    if (err != ESP_OK) {
+      break;
+    }
+  }
+  if (err == ESP_OK) {
+    err = setU16IfChanged(nvsHandle, LLM_TIMEOUT_KEY, config.llmTimeoutSeconds, changedCount);
+  }
+  if (err == ESP_OK) {
+    err = setU8IfChanged(nvsHandle, SCHEMA_VERSION_KEY, SCHEMA_VERSION, changedCount);
+  }
+
+  uint32_t generation = 0;
+  nvs_get_u32(nvsHandle, GENERATION_KEY, &generation);
+  if (err == ESP_OK && changedCount > 0) {
+    generation++;
+    err = nvs_set_u32(nvsHandle, GENERATION_KEY, generation);
+  }
+
   if (err != ESP_OK) {
     Serial.printf("Error saving config to NVS: %s\n", esp_err_to_name(err));
     nvs_close(nvsHandle);
     return false;
   }
 
+  if (changedCount == 0) {
+    nvs_close(nvsHandle);
+    storeMirror(configMirror, config, generation);
+    Serial.println("Configuration unchanged, nothing written to NVS");
+    return true;
+  }
+
   err = nvs_commit(nvsHandle);
   if (err != ESP_OK) {
     Serial.printf("Error committing to NVS: %s\n", esp_err_to_name(err));
@@ -40,42 +213,150 @@ bool ApplicationConfigStorage::save(const ApplicationConfig& config) {
   }
 
   nvs_close(nvsHandle);
-  Serial.println("Configuration saved to NVS successfully");
+  storeMirror(configMirror, config, generation);
+  Serial.printf("Configuration saved to NVS successfully (%d settings changed, generation %lu)\n", changedCount,
+                (unsigned long)generation);
   return true;
 }
 
 std::unique_ptr<ApplicationConfig> ApplicationConfigStorage::load() {
+  if (isMirrorValid(configMirror)) {
+    std::unique_ptr<ApplicationConfig> config(new ApplicationConfig());
+    memcpy(config.get(), configMirror.config, sizeof(ApplicationConfig));
+    Serial.printf("Configuration loaded from RTC mirror (generation %lu)\n", (unsigned long)configMirror.generation);
+    return config;
+  }
+
+  initializeNvs();
   nvs_handle_t nvsHandle;
   esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvsHandle);
-  if (err != ESP_OK) {
+  if (err == ESP_ERR_NVS_NOT_FOUND) {
+    Serial.println("No configuration found in NVS");
+    return nullptr;
+  } else if (err != ESP_OK) {
     Serial.printf("Error opening NVS handle for reading: %s\n", esp_err_to_name(err));
     return nullptr;
   }
 
-  size_t requiredSize = sizeof(ApplicationConfig);
+  uint8_t schemaVersion = 0;
+  err = nvs_get_u8(nvsHandle, SCHEMA_VERSION_KEY, &schemaVersion);
+  if (err == ESP_ERR_NVS_NOT_FOUND) {
+    nvs_close(nvsHandle);
+    return migrateFromSchemaV1Blob();
+  } else if (err != ESP_OK) {
+    Serial.printf("Error reading config schema from NVS: %s\n", esp_err_to_name(err));
+    nvs_close(nvsHandle);
+    return nullptr;
+  }
+
+  if (schemaVersion > SCHEMA_VERSION) {
+    Serial.printf("Configuration schema %u is newer than supported %u, ignoring stored config\n", schemaVersion,
+                  SCHEMA_VERSION);
+    nvs_close(nvsHandle);
+    return nullptr;
+  }
+
   std::unique_ptr<ApplicationConfig> config(new ApplicationConfig());
+  for (const StringSetting& setting : STRING_SETTINGS) {
+    size_t length = setting.size;
+    err = nvs_get_str(nvsHandle, setting.key, settingField(*config, setting), &length);
+    if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+      Serial.printf("Error reading %s from NVS: %s, using default\n", setting.key, esp_err_to_name(err));
+    }
+  }
 
-  err = nvs_get_blob(nvsHandle, CONFIG_KEY, config.get(), &requiredSize);
+  uint16_t llmTimeoutSeconds;
+  if (nvs_get_u16(nvsHandle, LLM_TIMEOUT_KEY, &llmTimeoutSeconds) == ESP_OK) {
+    config->llmTimeoutSeconds = llmTimeoutSeconds;
+  }
+
+  uint32_t generation = 0;
+  nvs_get_u32(nvsHandle, GENERATION_KEY, &generation);
+  nvs_close(nvsHandle);
+
+  storeMirror(configMirror, *config, generation);
+  Serial.println("Configuration loaded from NVS successfully");
+  return config;
+}
+
+std::unique_ptr<ApplicationConfig> ApplicationConfigStorage::migrateFromSchemaV1Blob() {
+  nvs_handle_t nvsHandle;
+  esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvsHandle);
+  if (err != ESP_OK) {
+    Serial.printf("Error opening NVS handle for reading: %s\n", esp_err_to_name(err));
+    return nullptr;
+  }
+
+  size_t blobSize = sizeof(SchemaV1ApplicationConfig);
+  std::unique_ptr<uint8_t[]> blob(new uint8_t[blobSize]);
+  err = nvs_get_blob(nvsHandle, SCHEMA_V1_CONFIG_KEY, blob.get(), &blobSize);
   nvs_close(nvsHandle);
 
   if (err == ESP_ERR_NVS_NOT_FOUND) {
     Serial.println("No configuration found in NVS");
     return nullptr;
   } else if (err != ESP_OK) {
-    Serial.printf("Error reading config from NVS: %s\n", esp_err_to_name(err));
+    Serial.printf("Error reading schema version 1 config from NVS: %s\n", esp_err_to_name(err));
     return nullptr;
   }
 
-  if (requiredSize != sizeof(ApplicationConfig)) {
-    Serial.println("Configuration size mismatch, ignoring stored config");
+  std::unique_ptr<ApplicationConfig> config(new ApplicationConfig());
+  DeviceState deviceState;
+  if (!migrateSchemaV1Blob(blob.get(), blobSize, *config, deviceState)) {
+    Serial.println("Schema version 1 configuration size mismatch, ignoring stored config");
     return nullptr;
   }
 
-  Serial.println("Configuration loaded from NVS successfully");
+  if (!save(*config)) {
+    return config;
+  }
+  if (deviceState.hasCoordinates()) {
+    saveCoordinates(deviceState.latitude(), deviceState.longitude());
+  }
+
+  if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvsHandle) == ESP_OK) {
+    nvs_erase_key(nvsHandle, SCHEMA_V1_CONFIG_KEY);
+    nvs_commit(nvsHandle);
+    nvs_close(nvsHandle);
+  }
+
+  Serial.printf("Migrated %u byte schema version 1 configuration to schema %u\n", (unsigned)blobSize, SCHEMA_VERSION);
   return config;
 }
 
+bool ApplicationConfigStorage::migrateSchemaV1Blob(const uint8_t* blob, size_t blobSize, ApplicationConfig& config,
+                                                   DeviceState& deviceState) {
+  if (blobSize != sizeof(SchemaV1ApplicationConfig) && blobSize != SCHEMA_V1_SIZE_WITHOUT_LLM_ENDPOINT) {
+    return false;
+  }
+
+  std::unique_ptr<SchemaV1ApplicationConfig> stored(new SchemaV1ApplicationConfig());
+  memcpy(stored.get(), blob, blobSize);
+
+  copyString(config.wifiSSID, sizeof(config.wifiSSID), stored->wifiSSID, sizeof(stored->wifiSSID));
+  copyString(config.wifiPassword, sizeof(config.wifiPassword), stored->wifiPassword, sizeof(stored->wifiPassword));
+  copyString(config.openaiApiKey, sizeof(config.openaiApiKey), stored->openaiApiKey, sizeof(stored->openaiApiKey));
+  copyString(config.aiPromptStyle, sizeof(config.aiPromptStyle), stored->aiPromptStyle, sizeof(stored->aiPromptStyle));
+  copyString(config.city, sizeof(config.city), stored->city, sizeof(stored->city));
+  copyString(config.countryCode, sizeof(config.countryCode), stored->countryCode, sizeof(stored->countryCode));
+  copyString(config.imageUrl, sizeof(config.imageUrl), stored->imageUrl, sizeof(stored->imageUrl));
+
+  if (blobSize == sizeof(SchemaV1ApplicationConfig)) {
+    copyString(config.llmBaseUrl, sizeof(config.llmBaseUrl), stored->llmBaseUrl, sizeof(stored->llmBaseUrl));
+    copyString(config.llmModel, sizeof(config.llmModel), stored->llmModel, sizeof(stored->llmModel));
+    config.llmTimeoutSeconds = stored->llmTimeoutSeconds;
+  }
+
+  bool isValidScreen = stored->currentScreenIndex >= 0 && stored->currentScreenIndex < SCREEN_COUNT;
+  deviceState.setCurrentScreenIndex(isValidScreen ? stored->currentScreenIndex : CURRENT_WEATHER_SCREEN);
+  deviceState.setCoordinates(stored->latitude, stored->longitude);
+  return true;
+}
+
 void ApplicationConfigStorage::clear() {
+  initializeNvs();
+  memset(&configMirror, 0, sizeof(configMirror));
+
   nvs_handle_t nvsHandle;
   esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvsHandle);
   if (err != ESP_OK) {
@@ -83,8 +364,8 @@ void ApplicationConfigStorage::clear() {
     return;
   }
 
-  err = nvs_erase_key(nvsHandle, CONFIG_KEY);
-  if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+  err = nvs_erase_all(nvsHandle);
+  if (err != ESP_OK) {
     Serial.printf("Error clearing config from NVS: %s\n", esp_err_to_name(err));
   } else {
     Serial.println("Configuration cleared from NVS");
@@ -92,4 +373,64 @@ void ApplicationConfigStorage::clear() {
 
   nvs_commit(nvsHandle);
   nvs_close(nvsHandle);
-}
\ No newline at end of file
+}
+
+bool ApplicationConfigStorage::saveCoordinates(float latitude, float longitude) {
+  initializeNvs();
+  nvs_handle_t nvsHandle;
+  esp_err_t err = nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvsHandle);
+  if (err != ESP_OK) {
+    Serial.printf("Error opening NVS handle: %s\n", esp_err_to_name(err));
+    return false;
+  }
+
+  int changedCount = 0;
+  err = setFloatIfChanged(nvsHandle, LATITUDE_KEY, latitude, changedCount);
+  if (err == ESP_OK) {
+    err = setFloatIfChanged(nvsHandle, LONGITUDE_KEY, longitude, changedCount);
+  }
+  if (err == ESP_OK && changedCount > 0) {
+    err = nvs_commit(nvsHandle);
+  }
+  nvs_close(nvsHandle);
+
+  if (err != ESP_OK) {
+    Serial.printf("Error saving coordinates to NVS: %s\n", esp_err_to_name(err));
+    return false;
+  }
+  return true;
+}
+
+bool ApplicationConfigStorage::loadCoordinates(DeviceState& deviceState) {
+  initializeNvs();
+  nvs_handle_t nvsHandle;
+  if (nvs_open(NVS_NAMESPACE, NVS_READONLY, &nvsHandle) != ESP_OK) {
+    return false;
+  }
+
+  float latitude;
+  float longitude;
+  bool hasCoordinates = getFloat(nvsHandle, LATITUDE_KEY, latitude) == ESP_OK &&
+                        getFloat(nvsHandle, LONGITUDE_KEY, longitude) == ESP_OK;
+  nvs_close(nvsHandle);
+
+  if (!hasCoordinates) {
+    return false;
+  }
+  deviceState.setCoordinates(latitude, longitude);
+  Serial.printf("Coordinates loaded from NVS: (%f, %f)\n", latitude, longitude);
+  return true;
+}
+
+void ApplicationConfigStorage::clearCoordinates() {
+  initializeNvs();
+  nvs_handle_t nvsHandle;
+  if (nvs_open(NVS_NAMESPACE, NVS_READWRITE, &nvsHandle) != ESP_OK) {
+    return;
+  }
+
+  nvs_erase_key(nvsHandle, LATITUDE_KEY);
+  nvs_erase_key(nvsHandle, LONGITUDE_KEY);
+  nvs_commit(nvsHandle);
+  nvs_close(nvsHandle);
+}
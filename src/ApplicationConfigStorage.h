@@ -1,11 +1,23 @@
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <memory>
 
 #include "ApplicationConfig.h"
+#include "DeviceState.h"
+
+struct ApplicationConfigMirror {
+  uint32_t generation;
+  uint32_t checksum;
+  uint8_t config[sizeof(ApplicationConfig)];
+};
 
 class ApplicationConfigStorage {
  public:
+  static const uint8_t SCHEMA_VERSION = 2;
+
   ApplicationConfigStorage();
   ~ApplicationConfigStorage();
 
@@ -13,7 +25,27 @@ class ApplicationConfigStorage {
   std::unique_ptr<ApplicationConfig> load();
   void clear();
 
+  bool saveCoordinates(float latitude, float longitude);
+  bool loadCoordinates(DeviceState& deviceState);
+  void clearCoordinates();
+
+  static bool migrateSchemaV1Blob(const uint8_t* blob, size_t blobSize, ApplicationConfig& config,
+                                  DeviceState& deviceState);
+
+  static uint32_t mirrorChecksum(const ApplicationConfigMirror& mirror);
+  static bool isMirrorValid(const ApplicationConfigMirror& mirror);
+  static void storeMirror(ApplicationConfigMirror& mirror, const ApplicationConfig& config, uint32_t generation);
+
  private:
   static const char* NVS_NAMESPACE;
-  static const char* CONFIG_KEY;
-};
\ No newline at end of file
+  static const char* SCHEMA_V1_CONFIG_KEY;
+  static const char* SCHEMA_VERSION_KEY;
+  static const char* LLM_TIMEOUT_KEY;
+  static const char* GENERATION_KEY;
+  static const char* LATITUDE_KEY;
+  static const char* LONGITUDE_KEY;
+
+  static void initializeNvs();
+
+  std::unique_ptr<ApplicationConfig> migrateFromSchemaV1Blob();
+};
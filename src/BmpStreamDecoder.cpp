@@ -0,0 +1,159 @@
+#include "BmpStreamDecoder.h"
+
+#include "GreyDitherer.h"
+
+BmpStreamDecoder::BmpStreamDecoder(Stream& stream, DisplayType& display)
+    : ImageDecoder(stream, display), imageWidth(0), imageHeight(0), bitsPerPixel(0), isTopDown(false) {
+  memset(paletteLuminance, 0, sizeof(paletteLuminance));
+}
+
+bool BmpStreamDecoder::readPalette(uint32_t colorCount) {
+  uint8_t entry[4];
+  for (uint32_t i = 0; i < colorCount; i++) {
+    if (!readFully(entry, sizeof(entry))) {
+      Serial.printf("Stream ended in the color palette at entry %lu\n", (unsigned long)i);
+      return false;
+    }
+    paletteLuminance[i] = luminance(entry[2], entry[1], entry[0]);
+    palettePacker.setPaletteEntry(i, paletteLuminance[i]);
+  }
+  return true;
+}
+
+bool BmpStreamDecoder::readHeader() {
+  uint8_t bmpHeader[HEADER_SIZE];
+  if (!readFully(bmpHeader, HEADER_SIZE)) {
+    Serial.printf("Stream too short for BMP header: got %lu bytes, expected %u\n", (unsigned long)bytesConsumed,
+                  (unsigned)HEADER_SIZE);
+    return false;
+  }
+
+  if (bmpHeader[0] != 'B' || bmpHeader[1] != 'M') {
+    Serial.printf("Invalid BMP signature: got 0x%02X 0x%02X, expected 0x42 0x4D ('BM')\n", bmpHeader[0], bmpHeader[1]);
+    return false;
+  }
+
+  uint32_t dataOffset = readUint32(bmpHeader + 10);
+  uint32_t infoHeaderSize = readUint32(bmpHeader + 14);
+  imageWidth = readUint32(bmpHeader + 18);
+  int32_t signedHeight = (int32_t)readUint32(bmpHeader + 22);
+  bitsPerPixel = readUint16(bmpHeader + 28);
+  uint32_t compression = readUint32(bmpHeader + 30);
+  uint32_t colorsUsed = readUint32(bmpHeader + 46);
+
+  isTopDown = signedHeight < 0;
+  imageHeight = isTopDown ? -signedHeight : signedHeight;
+
+  if (bitsPerPixel != 8 && bitsPerPixel != 24) {
+    Serial.printf("Unsupported bits per pixel: %d (expected 8 or 24)\n", bitsPerPixel);
+    return false;
+  }
+
+  if (compression != 0) {
+    Serial.printf("Unsupported compression: %lu (expected 0 for uncompressed)\n", (unsigned long)compression);
+    return false;
+  }
+
+  if (imageWidth == 0 || imageWidth > MAX_IMAGE_WIDTH || imageHeight == 0) {
+    Serial.printf("Unsupported image size: %lux%lu\n", (unsigned long)imageWidth, (unsigned long)imageHeight);
+    return false;
+  }
+
+  if (infoHeaderSize < HEADER_SIZE - 14 || dataOffset < 14 + infoHeaderSize) {
+    Serial.printf("Unsupported BMP layout: info header %lu bytes, pixel data at %lu\n",
+                  (unsigned long)infoHeaderSize, (unsigned long)dataOffset);
+    return false;
+  }
+
+  if (!skip(14 + infoHeaderSize - bytesConsumed)) {
+    Serial.println("Stream ended in the BMP info header");
+    return false;
+  }
+
+  if (bitsPerPixel == 8) {
+    uint32_t colorCount = colorsUsed == 0 || colorsUsed > 256 ? 256 : colorsUsed;
+    colorCount = min<uint32_t>(colorCount, (dataOffset - bytesConsumed) / 4);
+    if (!readPalette(colorCount)) {
+      return false;
+    }
+  }
+
+  return skip(dataOffset - bytesConsumed);
+}
+
+void BmpStreamDecoder::scaleRowLuminance(const uint8_t* sourceRow, uint8_t* luminanceRow,
+                                         int16_t scaledWidth) const {
+  uint32_t step = ((uint32_t)imageWidth << 16) / scaledWidth;
+  uint32_t position = step >> 1;
+
+  for (int16_t x = 0; x < scaledWidth; x++, position += step) {
+    uint32_t sourceX = position >> 16;
+    if (bitsPerPixel == 8) {
+      luminanceRow[x] = paletteLuminance[sourceRow[sourceX]];
+    } else {
+      const uint8_t* pixel = sourceRow + sourceX * 3;
+      luminanceRow[x] = luminance(pixel[2], pixel[1], pixel[0]);
+    }
+  }
+}
+
+ImageLayout BmpStreamDecoder::layoutFor(int16_t targetWidth, int16_t targetHeight) const {
+  ImageLayout layout;
+  fitWithin(imageWidth, imageHeight, targetWidth, targetHeight, layout.width, layout.height);
+  layout.x = (targetWidth - layout.width) / 2;
+  layout.y = (targetHeight - layout.height) / 2;
+  layout.isBottomUp = !isTopDown;
+  return layout;
+}
+
+bool BmpStreamDecoder::draw(const ImageLayout& layout, ImageCache* cache) {
+  int16_t scaledWidth = layout.width;
+  int16_t scaledHeight = layout.height;
+  size_t packedRowBytes = (scaledWidth + 3) / 4;
+
+  bool isDirectlyPackable = bitsPerPixel == 8 && palettePacker.isExactGreyPalette() &&
+                            (uint32_t)scaledWidth == imageWidth && (uint32_t)scaledHeight == imageHeight;
+
+  Serial.printf("%s %lux%lu %d-bit BMP to %dx%d\n", isDirectlyPackable ? "Packing" : "Scaling and dithering",
+                (unsigned long)imageWidth, (unsigned long)imageHeight, bitsPerPixel, scaledWidth, scaledHeight);
+
+  uint32_t rowSize = ((imageWidth * bitsPerPixel + 31) / 32) * 4;
+  uint8_t* rowBuffer = new uint8_t[rowSize];
+  uint8_t* luminanceRow = new uint8_t[scaledWidth];
+  uint8_t* packedRow = new uint8_t[packedRowBytes];
+  GreyDitherer ditherer(scaledWidth);
+
+  bool isComplete = true;
+  for (uint32_t row = 0; row < imageHeight; row++) {
+    if (!readFully(rowBuffer, rowSize)) {
+      Serial.printf("Stream ended at image row %lu of %lu\n", (unsigned long)row, (unsigned long)imageHeight);
+      isComplete = false;
+      break;
+    }
+
+    uint32_t sourceY = isTopDown ? row : imageHeight - 1 - row;
+    int16_t firstScaledY = (sourceY * scaledHeight + imageHeight - 1) / imageHeight;
+    int16_t endScaledY = ((sourceY + 1) * scaledHeight + imageHeight - 1) / imageHeight;
+    if (firstScaledY == endScaledY) {
+      continue;
+    }
+
+    if (isDirectlyPackable) {
+      palettePacker.packRow(rowBuffer, imageWidth, packedRow);
+      emitRow(layout, sourceY, packedRow, packedRowBytes, cache);
+      continue;
+    }
+
+    scaleRowLuminance(rowBuffer, luminanceRow, scaledWidth);
+    for (int16_t i = 0; i < endScaledY - firstScaledY; i++) {
+      int16_t y = isTopDown ? firstScaledY + i : endScaledY - 1 - i;
+      ditherer.ditherRow(luminanceRow, packedRow);
+      emitRow(layout, y, packedRow, packedRowBytes, cache);
+    }
+  }
+
+  delete[] rowBuffer;
+  delete[] luminanceRow;
+  delete[] packedRow;
+  return isComplete;
+}
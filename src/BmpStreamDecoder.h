@@ -0,0 +1,30 @@
+#pragma once
+
+#include "GreyPixelPacker.h"
+#include "ImageDecoder.h"
+
+class BmpStreamDecoder : public ImageDecoder {
+ public:
+  static const size_t HEADER_SIZE = 54;
+  static const uint32_t MAX_IMAGE_WIDTH = 4096;
+
+  BmpStreamDecoder(Stream& stream, DisplayType& display);
+
+  bool readHeader() override;
+  ImageLayout layoutFor(int16_t targetWidth, int16_t targetHeight) const override;
+  bool draw(const ImageLayout& layout, ImageCache* cache) override;
+
+  uint32_t width() const { return imageWidth; }
+  uint32_t height() const { return imageHeight; }
+
+ private:
+  uint32_t imageWidth;
+  uint32_t imageHeight;
+  uint16_t bitsPerPixel;
+  bool isTopDown;
+  uint8_t paletteLuminance[256];
+  GreyPixelPacker palettePacker;
+
+  bool readPalette(uint32_t colorCount);
+  void scaleRowLuminance(const uint8_t* sourceRow, uint8_t* luminanceRow, int16_t scaledWidth) const;
+};
@@ -1,92 +1,214 @@
 #include "ChatGPTClient.h"
 
-const char* OPENAI_BASE_URL = "https://api.openai.com";
+#include <memory>
 
-ChatGPTClient::ChatGPTClient(const char* apiKey) {
-  this->apiKey = apiKey;
-  baseUrl = OPENAI_BASE_URL;
-  model = "gpt-4.1-mini";
-  client.setInsecure();
+static const size_t SUMMARY_LENGTH_HEADROOM_FACTOR = 2;
+
+ChatGPTClient::ChatGPTClient(const char* apiKey, const char* baseUrl, const char* model, uint32_t timeoutMillis)
+    : apiKey(apiKey), baseUrl(baseUrl), model(model), timeoutMillis(timeoutMillis) {
+  while (this->baseUrl.endsWith("/")) {
+    this->baseUrl.remove(this->baseUrl.length() - 1);
+  }
+  secureClient.setInsecure();
+}
+
+WiFiClient& ChatGPTClient::clientForBaseUrl() {
+  if (baseUrl.startsWith("http://")) {
+    return plainClient;
+  }
+  return secureClient;
+}
+
+void ChatGPTClient::parseHostAndPort(const String& url, String& host, uint16_t& port) {
+  int authorityStart = url.indexOf("://") + 3;
+  int pathStart = url.indexOf('/', authorityStart);
+  String authority = url.substring(authorityStart, pathStart < 0 ? url.length() : pathStart);
+
+  int portSeparator = authority.lastIndexOf(':');
+  if (portSeparator < 0) {
+    host = authority;
+    port = url.startsWith("http://") ? 80 : 443;
+  } else {
+    host = authority.substring(0, portSeparator);
+    port = authority.substring(portSeparator + 1).toInt();
+  }
 }
 
 ChatGPTClient::~ChatGPTClient() { http.end(); }
 
-String ChatGPTClient::makeRequest(const String& endpoint, const String& payload) {
-  String url = String(baseUrl) + endpoint;
+void ChatGPTClient::logRequestError(int httpResponseCode) {
+  Serial.println("Error in HTTP request: " + String(httpResponseCode));
+  Serial.println("Error details:");
+  switch (httpResponseCode) {
+    case -1:
+      Serial.println("Connection failed");
+      break;
+    case -2:
+      Serial.println("Send header failed");
+      break;
+    case -3:
+      Serial.println("Send payload failed");
+      break;
+    case -4:
+      Serial.println("Not connected");
+      break;
+    case -5:
+      Serial.println("Connection lost");
+      break;
+    case -6:
+      Serial.println("No stream");
+      break;
+    case -7:
+      Serial.println("No HTTP server");
+      break;
+    case -8:
+      Serial.println("Too less RAM");
+      break;
+    case -9:
+      Serial.println("Encoding error");
+      break;
+    case -10:
+      Serial.println("Stream write error");
+      break;
+    case -11:
+      Serial.println("Read timeout");
+      break;
+    default:
+      Serial.println("Unknown error");
+  }
+}
+
+String ChatGPTClient::streamCompletion(const String& endpoint, const String& payload, SseTokenParser& parser) {
+  String url = baseUrl + endpoint;
 
   Serial.println("Request URL: " + url);
   Serial.println("Payload size: " + String(payload.length()) + " bytes");
 
+  uint32_t startedAtMillis = millis();
+  auto remainingMillis = [&]() -> uint32_t {
+    uint32_t elapsedMillis = millis() - startedAtMillis;
+    return elapsedMillis < timeoutMillis ? timeoutMillis - elapsedMillis : 0;
+  };
+
+  String host;
+  uint16_t port;
+  parseHostAndPort(url, host, port);
+  WiFiClient& client = clientForBaseUrl();
+  if (!client.connect(host.c_str(), port, remainingMillis())) {
+    Serial.printf("Connection to %s:%u failed within %lu ms\n", host.c_str(), port, (unsigned long)timeoutMillis);
+    return "";
+  }
+
+  http.useHTTP10(true);
   http.begin(client, url);
   http.addHeader("Content-Type", "application/json");
-  http.addHeader("Authorization", "Bearer " + String(apiKey));
-
-  http.setTimeout(30000);  // 30 second timeout
+  http.addHeader("Accept", "text/event-stream");
+  if (strlen(apiKey) > 0) {
+    http.addHeader("Authorization", "Bearer " + String(apiKey));
+  }
 
+  http.setTimeout(remainingMillis());
   int httpResponseCode = http.POST(payload);
-  String response = "";
 
-  if (httpResponseCode > 0) {
-    response = http.getString();
-    Serial.println("HTTP Response Code: " + String(httpResponseCode));
-  } else {
-    Serial.println("Error in HTTP request: " + String(httpResponseCode));
-    Serial.println("Error details:");
-    switch (httpResponseCode) {
-      case -1:
-        Serial.println("Connection failed");
-        break;
-      case -2:
-        Serial.println("Send header failed");
-        break;
-      case -3:
-        Serial.println("Send payload failed");
-        break;
-      case -4:
-        Serial.println("Not connected");
-        break;
-      case -5:
-        Serial.println("Connection lost");
-        break;
-      case -6:
-        Serial.println("No stream");
-        break;
-      case -7:
-        Serial.println("No HTTP server");
-        break;
-      case -8:
-        Serial.println("Too less RAM");
-        break;
-      case -9:
-        Serial.println("Encoding error");
-        break;
-      case -10:
-        Serial.println("Stream write error");
-        break;
-      case -11:
-        Serial.println("Read timeout");
-        break;
-      default:
-        Serial.println("Unknown error");
+  if (httpResponseCode <= 0) {
+    logRequestError(httpResponseCode);
+    http.end();
+    return "";
+  }
+
+  Serial.println("HTTP Response Code: " + String(httpResponseCode));
+  if (httpResponseCode != HTTP_CODE_OK) {
+    Serial.println(http.getString());
+    http.end();
+    return "";
+  }
+
+  WiFiClient* stream = http.getStreamPtr();
+  char chunk[256];
+  uint32_t firstTokenMillis = 0;
+
+  while (!parser.isComplete() && (stream->connected() || stream->available()) && remainingMillis() > 0) {
+    int available = stream->available();
+    if (available <= 0) {
+      delay(5);
+      continue;
+    }
+
+    int bytesRead = stream->readBytes(chunk, min((size_t)available, sizeof(chunk)));
+    parser.feed(chunk, bytesRead);
+    if (firstTokenMillis == 0 && parser.hasContent()) {
+      firstTokenMillis = millis() - startedAtMillis;
     }
   }
 
+  const char* outcome = parser.isTruncated() ? "truncated" : parser.isComplete() ? "complete" : "cut off";
+  Serial.printf("Streamed completion: first token after %lu ms, %s after %lu ms\n", (unsigned long)firstTokenMillis,
+                outcome, (unsigned long)(millis() - startedAtMillis));
+
   http.end();
-  return response;
+  return String(parser.content());
 }
 
 void ChatGPTClient::setModel(const String& modelName) { model = modelName; }
 
-String ChatGPTClient::generateContent(const String& prompt) {
-  String endpoint = "/v1/chat/completions";
+bool ChatGPTClient::generateSummaries(const String& prompt, size_t count, size_t maxSummaryLength,
+                                      std::vector<String>& summaries) {
+  std::unique_ptr<SseTokenParser> parser(
+      new SseTokenParser(count * maxSummaryLength * SUMMARY_LENGTH_HEADROOM_FACTOR, true));
+  String response = requestCompletion(prompt, *parser);
+
+  int arrayStart = response.indexOf('[');
+  int arrayEnd = response.lastIndexOf(']');
+  if (arrayStart < 0 || arrayEnd < arrayStart) {
+    Serial.println("Error: Response does not contain a JSON array");
+    Serial.println(response);
+    return false;
+  }
+
+  DynamicJsonDocument doc(JSON_ARRAY_SIZE(count + 1) + response.length());
+  DeserializationError error = deserializeJson(doc, response.substring(arrayStart, arrayEnd + 1));
+  if (error || !doc.is<JsonArray>()) {
+    Serial.printf("Error: Could not parse summaries: %s\n", error.c_str());
+    return false;
+  }
+
+  summaries.clear();
+  for (JsonVariant summary : doc.as<JsonArray>()) {
+    if (summaries.size() >= count) {
+      break;
+    }
+    if (summary.is<const char*>()) {
+      summaries.push_back(summary.as<String>());
+    }
+  }
 
+  Serial.printf("Received %u of %u requested summaries\n", (unsigned)summaries.size(), (unsigned)count);
+  return !summaries.empty();
+}
+
+String ChatGPTClient::generateContent(const String& prompt) {
   if (prompt.length() == 0) {
     Serial.println("Error: Empty prompt");
     return "Error: Empty prompt";
   }
 
+  std::unique_ptr<SseTokenParser> parser(new SseTokenParser());
+  String response = requestCompletion(prompt, *parser);
+
+  if (response.length() > 0) {
+    return response;
+  }
+
+  Serial.println("Error: Could not parse response");
+
+  return "Error: Could not parse response";
+}
+
+String ChatGPTClient::requestCompletion(const String& prompt, SseTokenParser& parser) {
+  String endpoint = "/v1/chat/completions";
+
   // Create OpenAI chat completions format
-  DynamicJsonDocument doc(8192);
+  DynamicJsonDocument doc(JSON_OBJECT_SIZE(6) + JSON_ARRAY_SIZE(1) + JSON_OBJECT_SIZE(2) + prompt.length() + 128);
   doc["model"] = model;
 
   JsonArray messages = doc.createNestedArray("messages");
@@ -96,22 +218,11 @@ String ChatGPTClient::generateContent(const String& prompt) {
 
   doc["max_tokens"] = 1000;
   doc["temperature"] = 0.7;
+  doc["stream"] = true;
 
   String payload;
   serializeJson(doc, payload);
+  doc.clear();
 
-  String response = makeRequest(endpoint, payload);
-
-  DynamicJsonDocument responseDoc(8192);
-  deserializeJson(responseDoc, response);
-
-  if (responseDoc.containsKey("choices") && responseDoc["choices"].size() > 0 &&
-      responseDoc["choices"][0].containsKey("message") && responseDoc["choices"][0]["message"].containsKey("content")) {
-    return responseDoc["choices"][0]["message"]["content"].as<String>();
-  }
-
-  Serial.println("Error: Could not parse response");
-  Serial.println(response);
-
-  return "Error: Could not parse response";
-}
\ No newline at end of file
+  return streamCompletion(endpoint, payload, parser);
+}
@@ -6,22 +6,34 @@
 #include <HTTPClient.h>
 #include <WiFiClientSecure.h>
 
+#include <vector>
+
+#include "SseTokenParser.h"
+
 class ChatGPTClient {
  private:
   const char* apiKey;
-  const char* baseUrl;
+  String baseUrl;
   String model;
-  WiFiClientSecure client;
+  uint32_t timeoutMillis;
+  WiFiClientSecure secureClient;
+  WiFiClient plainClient;
   HTTPClient http;
 
-  String makeRequest(const String& endpoint, const String& payload);
+  WiFiClient& clientForBaseUrl();
+  static void parseHostAndPort(const String& url, String& host, uint16_t& port);
+
+  String requestCompletion(const String& prompt, SseTokenParser& parser);
+  String streamCompletion(const String& endpoint, const String& payload, SseTokenParser& parser);
+  void logRequestError(int httpResponseCode);
 
  public:
-  ChatGPTClient(const char* apiKey);
+  ChatGPTClient(const char* apiKey, const char* baseUrl, const char* model, uint32_t timeoutMillis);
   ~ChatGPTClient();
 
   void setModel(const String& modelName);
   String generateContent(const String& prompt);
+  bool generateSummaries(const String& prompt, size_t count, size_t maxSummaryLength, std::vector<String>& summaries);
 };
 
 #endif
\ No newline at end of file
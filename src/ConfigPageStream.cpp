@@ -0,0 +1,161 @@
+#include "ConfigPageStream.h"
+
+#include <rom/crc.h>
+#include <string.h>
+
+#include "config_page.h"
+
+static const uint8_t GZIP_HEADER[] = {0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff};
+static const size_t MAX_STORED_BLOCK_LENGTH = 0xffff;
+static const uint8_t NON_FINAL_STORED_BLOCK_TYPE = 0x00;
+
+static uint32_t gf2MatrixTimes(const uint32_t* matrix, uint32_t vector) {
+  uint32_t sum = 0;
+  for (; vector; vector >>= 1, matrix++) {
+    if (vector & 1) {
+      sum ^= *matrix;
+    }
+  }
+  return sum;
+}
+
+static void gf2MatrixSquare(uint32_t* square, const uint32_t* matrix) {
+  for (int n = 0; n < 32; n++) {
+    square[n] = gf2MatrixTimes(matrix, matrix[n]);
+  }
+}
+
+uint32_t ConfigPageStream::crc32Combine(uint32_t crc1, uint32_t crc2, size_t length2) {
+  if (length2 == 0) {
+    return crc1;
+  }
+
+  uint32_t even[32];
+  uint32_t odd[32];
+  odd[0] = 0xedb88320u;
+  uint32_t row = 1;
+  for (int n = 1; n < 32; n++) {
+    odd[n] = row;
+    row <<= 1;
+  }
+  gf2MatrixSquare(even, odd);
+  gf2MatrixSquare(odd, even);
+
+  do {
+    gf2MatrixSquare(even, odd);
+    if (length2 & 1) {
+      crc1 = gf2MatrixTimes(even, crc1);
+    }
+    length2 >>= 1;
+    if (length2 == 0) {
+      break;
+    }
+
+    gf2MatrixSquare(odd, even);
+    if (length2 & 1) {
+      crc1 = gf2MatrixTimes(odd, crc1);
+    }
+    length2 >>= 1;
+  } while (length2 != 0);
+
+  return crc1 ^ crc2;
+}
+
+String ConfigPageStream::escapeHtml(const String& value) {
+  String escaped;
+  escaped.reserve(value.length());
+  for (size_t i = 0; i < value.length(); i++) {
+    char c = value[i];
+    switch (c) {
+      case '&':
+        escaped += "&amp;";
+        break;
+      case '"':
+        escaped += "&quot;";
+        break;
+      case '<':
+        escaped += "&lt;";
+        break;
+      case '>':
+        escaped += "&gt;";
+        break;
+      default:
+        escaped += c;
+        break;
+    }
+  }
+  return escaped;
+}
+
+void ConfigPageStream::prepare(const PlaceholderLookup& lookup) {
+  segments.clear();
+  values.clear();
+  storedBlockHeaders.clear();
+  values.reserve(CONFIG_PAGE_CHUNK_COUNT);
+  storedBlockHeaders.reserve(CONFIG_PAGE_CHUNK_COUNT);
+
+  uint32_t crc = 0;
+  uint32_t pageLength = 0;
+  segments.push_back({GZIP_HEADER, sizeof(GZIP_HEADER)});
+
+  for (size_t i = 0; i < CONFIG_PAGE_CHUNK_COUNT; i++) {
+    const ConfigPageChunk& chunk = CONFIG_PAGE_CHUNKS[i];
+    segments.push_back({chunk.deflated, chunk.deflatedLength});
+    crc = crc32Combine(crc, chunk.crc, chunk.length);
+    pageLength += chunk.length;
+
+    if (chunk.placeholder == nullptr) {
+      continue;
+    }
+
+    values.push_back(escapeHtml(lookup(chunk.placeholder)));
+    String& value = values.back();
+    if (value.length() > MAX_STORED_BLOCK_LENGTH) {
+      value.remove(MAX_STORED_BLOCK_LENGTH);
+    }
+
+    uint16_t valueLength = value.length();
+    uint16_t complement = ~valueLength;
+    storedBlockHeaders.push_back({NON_FINAL_STORED_BLOCK_TYPE, (uint8_t)(valueLength & 0xff),
+                                  (uint8_t)(valueLength >> 8), (uint8_t)(complement & 0xff),
+                                  (uint8_t)(complement >> 8)});
+    segments.push_back({storedBlockHeaders.back().data(), storedBlockHeaders.back().size()});
+    segments.push_back({reinterpret_cast<const uint8_t*>(value.c_str()), valueLength});
+    crc = crc32_le(crc, reinterpret_cast<const uint8_t*>(value.c_str()), valueLength);
+    pageLength += valueLength;
+  }
+
+  for (int i = 0; i < 4; i++) {
+    gzipTrailer[i] = (crc >> (8 * i)) & 0xff;
+    gzipTrailer[4 + i] = (pageLength >> (8 * i)) & 0xff;
+  }
+  segments.push_back({gzipTrailer, sizeof(gzipTrailer)});
+
+  totalLength = 0;
+  for (const Segment& segment : segments) {
+    totalLength += segment.length;
+  }
+}
+
+size_t ConfigPageStream::length() const { return totalLength; }
+
+size_t ConfigPageStream::read(uint8_t* buffer, size_t maxLength, size_t offset) const {
+  size_t written = 0;
+  size_t segmentStart = 0;
+  for (const Segment& segment : segments) {
+    if (written == maxLength) {
+      break;
+    }
+
+    size_t segmentEnd = segmentStart + segment.length;
+    if (offset < segmentEnd) {
+      size_t from = offset - segmentStart;
+      size_t count = min(segment.length - from, maxLength - written);
+      memcpy(buffer + written, segment.data + from, count);
+      written += count;
+      offset += count;
+    }
+    segmentStart = segmentEnd;
+  }
+  return written;
+}
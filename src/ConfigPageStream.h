@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <functional>
+#include <vector>
+
+struct ConfigPageChunk {
+  const uint8_t* deflated;
+  uint16_t deflatedLength;
+  uint16_t length;
+  uint32_t crc;
+  const char* placeholder;
+};
+
+class ConfigPageStream {
+ public:
+  using PlaceholderLookup = std::function<String(const char* placeholder)>;
+
+  ConfigPageStream() = default;
+  ConfigPageStream(const ConfigPageStream&) = delete;
+  ConfigPageStream& operator=(const ConfigPageStream&) = delete;
+
+  void prepare(const PlaceholderLookup& lookup);
+  size_t length() const;
+  size_t read(uint8_t* buffer, size_t maxLength, size_t offset) const;
+
+  static String escapeHtml(const String& value);
+  static uint32_t crc32Combine(uint32_t crc1, uint32_t crc2, size_t length2);
+
+ private:
+  struct Segment {
+    const uint8_t* data;
+    size_t length;
+  };
+
+  std::vector<Segment> segments;
+  std::vector<String> values;
+  std::vector<std::array<uint8_t, 5>> storedBlockHeaders;
+  uint8_t gzipTrailer[8];
+  size_t totalLength = 0;
+};
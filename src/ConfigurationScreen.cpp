@@ -1,5 +1,7 @@
 #include "ConfigurationScreen.h"
 
+#include "FrameHistory.h"
+
 ConfigurationScreen::ConfigurationScreen(DisplayType& display)
     : display(display), accessPointName("WeatherStation-Config"), accessPointPassword("configure123") {
   gfx.begin(display);
@@ -107,7 +109,8 @@ void ConfigurationScreen::render() {
 
   drawQRCode(wifiQRCodeString, qrCodePositionX, qrCodePositionY, qrCodePixelScale);
 
-  display.displayWindow(0, 0, display.width(), display.height());
+  FrameHistory frameHistory;
+  frameHistory.refresh(display);
   display.hibernate();
 
   Serial.println("Configuration screen with enhanced QR code displayed");
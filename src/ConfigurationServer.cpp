@@ -1,9 +1,18 @@
 #include "ConfigurationServer.h"
 
-#include <SPIFFS.h>
 #include <WiFi.h>
 #include <WiFiAP.h>
 
+static const EventBits_t CONFIGURATION_SAVED_BIT = 1 << 0;
+static const EventBits_t BUTTON_PRESSED_BIT = 1 << 1;
+static const EventBits_t CLIENT_ACTIVITY_BIT = 1 << 2;
+
+static const uint32_t DNS_TASK_STACK_SIZE = 4096;
+static const uint32_t DNS_POLL_INTERVAL_MILLIS = 20;
+static const uint32_t BUTTON_DEBOUNCE_MILLIS = 50;
+
+static const uint32_t LOWEST_WIFI_CPU_FREQUENCY_MHZ = 80;
+
 ConfigurationServer::ConfigurationServer(const Configuration &currentConfig)
     : deviceName("LilyGo-Weather-Station"),
       wifiAccessPointName("WeatherStation-Config"),
@@ -11,7 +20,18 @@ ConfigurationServer::ConfigurationServer(const Configuration &currentConfig)
       currentConfiguration(currentConfig),
       server(nullptr),
       dnsServer(nullptr),
-      isServerRunning(false) {}
+      isServerRunning(false),
+      events(xEventGroupCreate()),
+      dnsTaskDone(xSemaphoreCreateBinary()),
+      isDnsTaskRunning(false),
+      stationConnectedEventId(0),
+      previousCpuFrequencyMhz(0) {}
+
+ConfigurationServer::~ConfigurationServer() {
+  stop();
+  vSemaphoreDelete(dnsTaskDone);
+  vEventGroupDelete(events);
+}
 
 void ConfigurationServer::run(OnSaveCallback onSaveCallback) {
   this->onSaveCallback = onSaveCallback;
@@ -20,19 +40,8 @@ void ConfigurationServer::run(OnSaveCallback onSaveCallback) {
   Serial.print("Device Name: ");
   Serial.println(deviceName);
 
-  if (!SPIFFS.begin(true)) {
-    Serial.println("SPIFFS Mount Failed - filesystem must be uploaded first");
-    return;
-  }
-  Serial.println("SPIFFS initialized successfully");
-
-  if (!loadHtmlTemplate()) {
-    Serial.println("Failed to load HTML template");
-    SPIFFS.end();
-    return;
-  }
-  Serial.println("HTML template loaded successfully");
-  SPIFFS.end();
+  configurationPage.prepare([this](const char *placeholder) { return getPlaceholderValue(placeholder); });
+  Serial.printf("Configuration page prepared, %u bytes gzip-encoded\n", (unsigned)configurationPage.length());
 
   WiFi.disconnect(true);
   delay(1000);
@@ -40,6 +49,9 @@ void ConfigurationServer::run(OnSaveCallback onSaveCallback) {
   Serial.print("Setting up WiFi Access Point: ");
   Serial.println(wifiAccessPointName);
 
+  previousCpuFrequencyMhz = getCpuFrequencyMhz();
+  setCpuFrequencyMhz(LOWEST_WIFI_CPU_FREQUENCY_MHZ);
+
   WiFi.mode(WIFI_AP);
   bool apStarted = WiFi.softAP(wifiAccessPointName.c_str(), wifiAccessPointPassword.c_str());
 
@@ -55,17 +67,24 @@ void ConfigurationServer::run(OnSaveCallback onSaveCallback) {
 
     setupDNSServer();
     setupWebServer();
+    stationConnectedEventId = WiFi.onEvent([this](WiFiEvent_t event, WiFiEventInfo_t info) { recordClientActivity(); },
+                                           ARDUINO_EVENT_WIFI_AP_STACONNECTED);
 
     isServerRunning = true;
     Serial.println("Captive portal is running!");
     Serial.println("Devices connecting to this network will be automatically redirected to the configuration page");
   } else {
     Serial.println("Failed to start Access Point!");
+    setCpuFrequencyMhz(previousCpuFrequencyMhz);
   }
 }
 
 void ConfigurationServer::stop() {
   if (isServerRunning) {
+    if (isDnsTaskRunning) {
+      isDnsTaskRunning = false;
+      xSemaphoreTake(dnsTaskDone, portMAX_DELAY);
+    }
     if (server) {
       delete server;
       server = nullptr;
@@ -75,25 +94,93 @@ void ConfigurationServer::stop() {
       delete dnsServer;
       dnsServer = nullptr;
     }
+    WiFi.removeEvent(stationConnectedEventId);
     WiFi.softAPdisconnect(true);
+    setCpuFrequencyMhz(previousCpuFrequencyMhz);
     isServerRunning = false;
     Serial.println("Configuration server stopped");
   }
 }
 
-void ConfigurationServer::handleRequests() {
-  if (isServerRunning && dnsServer) {
-    dnsServer->processNextRequest();
+ConfigurationExitReason ConfigurationServer::waitForExit(int buttonPin, uint32_t inactivityTimeoutMillis) {
+  xEventGroupClearBits(events, CONFIGURATION_SAVED_BIT | BUTTON_PRESSED_BIT | CLIENT_ACTIVITY_BIT);
+  attachInterruptArg(buttonPin, handleButtonInterrupt, events, FALLING);
+
+  ConfigurationExitReason exitReason = CONFIGURATION_INACTIVE;
+  uint32_t lastActivityMillis = millis();
+  while (true) {
+    uint32_t idleMillis = millis() - lastActivityMillis;
+    if (idleMillis >= inactivityTimeoutMillis) {
+      Serial.printf("No client activity for %lu s - exiting configuration mode\n",
+                    (unsigned long)(inactivityTimeoutMillis / 1000));
+      break;
+    }
+
+    EventBits_t bits = xEventGroupWaitBits(events, CONFIGURATION_SAVED_BIT | BUTTON_PRESSED_BIT | CLIENT_ACTIVITY_BIT,
+                                           pdTRUE, pdFALSE, pdMS_TO_TICKS(inactivityTimeoutMillis - idleMillis));
+
+    if (bits & CONFIGURATION_SAVED_BIT) {
+      exitReason = CONFIGURATION_SAVED;
+      break;
+    }
+
+    if (bits & CLIENT_ACTIVITY_BIT) {
+      lastActivityMillis = millis();
+    }
+
+    if (bits & BUTTON_PRESSED_BIT) {
+      delay(BUTTON_DEBOUNCE_MILLIS);
+      if (digitalRead(buttonPin) == LOW) {
+        Serial.println("Button pressed - exiting configuration mode");
+        exitReason = CONFIGURATION_BUTTON_PRESSED;
+        break;
+      }
+    }
+  }
+
+  detachInterrupt(buttonPin);
+
+  if (exitReason == CONFIGURATION_SAVED) {
+    onSaveCallback(savedConfiguration);
+  }
+  return exitReason;
+}
+
+void IRAM_ATTR ConfigurationServer::handleButtonInterrupt(void *parameter) {
+  BaseType_t higherPriorityTaskWoken = pdFALSE;
+  xEventGroupSetBitsFromISR(static_cast<EventGroupHandle_t>(parameter), BUTTON_PRESSED_BIT, &higherPriorityTaskWoken);
+  if (higherPriorityTaskWoken) {
+    portYIELD_FROM_ISR();
   }
 }
 
+void ConfigurationServer::recordClientActivity() { xEventGroupSetBits(events, CLIENT_ACTIVITY_BIT); }
+
 void ConfigurationServer::setupDNSServer() {
   dnsServer = new DNSServer();
   const byte DNS_PORT = 53;
   dnsServer->start(DNS_PORT, "*", WiFi.softAPIP());
+
+  isDnsTaskRunning = true;
+  if (xTaskCreate(dnsTask, "captiveDns", DNS_TASK_STACK_SIZE, this, 1, nullptr) != pdPASS) {
+    isDnsTaskRunning = false;
+    Serial.println("Failed to start DNS task - captive portal redirect unavailable");
+    return;
+  }
   Serial.println("DNS Server started - all domains redirect to captive portal");
 }
 
+void ConfigurationServer::dnsTask(void *parameter) {
+  ConfigurationServer *configurationServer = static_cast<ConfigurationServer *>(parameter);
+  while (configurationServer->isDnsTaskRunning) {
+    configurationServer->dnsServer->processNextRequest();
+    vTaskDelay(pdMS_TO_TICKS(DNS_POLL_INTERVAL_MILLIS));
+  }
+
+  xSemaphoreGive(configurationServer->dnsTaskDone);
+  vTaskDelete(nullptr);
+}
+
 void ConfigurationServer::setupWebServer() {
   server = new AsyncWebServer(80);
 
@@ -114,11 +201,18 @@ void ConfigurationServer::setupWebServer() {
 }
 
 void ConfigurationServer::handleRoot(AsyncWebServerRequest *request) {
-  String html = getConfigurationPage();
-  request->send(200, "text/html", html);
+  recordClientActivity();
+  AsyncWebServerResponse *response =
+      request->beginResponse("text/html", configurationPage.length(),
+                             [this](uint8_t *buffer, size_t maxLength, size_t index) -> size_t {
+                               return configurationPage.read(buffer, maxLength, index);
+                             });
+  response->addHeader("Content-Encoding", "gzip");
+  request->send(response);
 }
 
 void ConfigurationServer::handleSave(AsyncWebServerRequest *request) {
+  recordClientActivity();
   if (request->hasParam("ssid", true) && request->hasParam("password", true)) {
     Configuration config;
     config.ssid = request->getParam("ssid", true)->value();
@@ -144,47 +238,47 @@ void ConfigurationServer::handleSave(AsyncWebServerRequest *request) {
       config.imageUrl = request->getParam("imageUrl", true)->value();
     }
 
+    if (request->hasParam("llmBaseUrl", true)) {
+      config.llmBaseUrl = request->getParam("llmBaseUrl", true)->value();
+    }
+
+    if (request->hasParam("llmModel", true)) {
+      config.llmModel = request->getParam("llmModel", true)->value();
+    }
+
+    if (request->hasParam("llmTimeoutSeconds", true)) {
+      config.llmTimeoutSeconds = request->getParam("llmTimeoutSeconds", true)->value();
+    }
+
     Serial.println("Configuration received");
     request->send(200, "text/plain", "OK");
 
-    onSaveCallback(config);
+    savedConfiguration = config;
+    xEventGroupSetBits(events, CONFIGURATION_SAVED_BIT);
   } else {
     request->send(400, "text/plain", "Missing parameters");
   }
-
-  stop();
 }
 
-void ConfigurationServer::handleNotFound(AsyncWebServerRequest *request) { request->redirect("/"); }
-
-bool ConfigurationServer::loadHtmlTemplate() {
-  File file = SPIFFS.open("/config.html", "r");
-  if (!file) {
-    Serial.println("Failed to open config.html file");
-    return false;
-  }
-
-  htmlTemplate = file.readString();
-  file.close();
-
-  if (htmlTemplate.length() == 0) {
-    Serial.println("config.html file is empty");
-    return false;
-  }
-
-  return true;
+void ConfigurationServer::handleNotFound(AsyncWebServerRequest *request) {
+  recordClientActivity();
+  request->redirect("/");
 }
 
-String ConfigurationServer::getConfigurationPage() {
-  String html = htmlTemplate;
-  html.replace("{{CURRENT_SSID}}", currentConfiguration.ssid);
-  html.replace("{{CURRENT_PASSWORD}}", currentConfiguration.password);
-  html.replace("{{CURRENT_OPENAI_KEY}}", currentConfiguration.openaiApiKey);
-  html.replace("{{CURRENT_AI_PROMPT_STYLE}}", currentConfiguration.aiPromptStyle);
-  html.replace("{{CURRENT_CITY}}", currentConfiguration.city);
-  html.replace("{{CURRENT_COUNTRY_CODE}}", currentConfiguration.countryCode);
-  html.replace("{{CURRENT_IMAGE_URL}}", currentConfiguration.imageUrl);
-  return html;
+String ConfigurationServer::getPlaceholderValue(const char *placeholder) const {
+  if (strcmp(placeholder, "CURRENT_SSID") == 0) return currentConfiguration.ssid;
+  if (strcmp(placeholder, "CURRENT_PASSWORD") == 0) return currentConfiguration.password;
+  if (strcmp(placeholder, "CURRENT_OPENAI_KEY") == 0) return currentConfiguration.openaiApiKey;
+  if (strcmp(placeholder, "CURRENT_AI_PROMPT_STYLE") == 0) return currentConfiguration.aiPromptStyle;
+  if (strcmp(placeholder, "CURRENT_CITY") == 0) return currentConfiguration.city;
+  if (strcmp(placeholder, "CURRENT_COUNTRY_CODE") == 0) return currentConfiguration.countryCode;
+  if (strcmp(placeholder, "CURRENT_IMAGE_URL") == 0) return currentConfiguration.imageUrl;
+  if (strcmp(placeholder, "CURRENT_LLM_BASE_URL") == 0) return currentConfiguration.llmBaseUrl;
+  if (strcmp(placeholder, "CURRENT_LLM_MODEL") == 0) return currentConfiguration.llmModel;
+  if (strcmp(placeholder, "CURRENT_LLM_TIMEOUT") == 0) return currentConfiguration.llmTimeoutSeconds;
+
+  Serial.printf("Unknown configuration page placeholder: %s\n", placeholder);
+  return "";
 }
 
 String ConfigurationServer::getWifiAccessPointName() const { return wifiAccessPointName; }
@@ -5,10 +5,15 @@
 #include <AsyncTCP.h>
 #include <DNSServer.h>
 #include <ESPAsyncWebServer.h>
-#include <SPIFFS.h>
+#include <WiFi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <freertos/semphr.h>
 
 #include <functional>
 
+#include "ConfigPageStream.h"
+
 struct Configuration {
   String ssid;
   String password;
@@ -17,29 +22,41 @@ struct Configuration {
   String city;
   String countryCode;
   String imageUrl;
+  String llmBaseUrl;
+  String llmModel;
+  String llmTimeoutSeconds;
 
   Configuration() = default;
 
   Configuration(const String &ssid, const String &password, const String &openaiApiKey, const String &aiPromptStyle,
-                const String &city, const String &countryCode, const String &imageUrl)
+                const String &city, const String &countryCode, const String &imageUrl, const String &llmBaseUrl,
+                const String &llmModel, const String &llmTimeoutSeconds)
       : ssid(ssid),
         password(password),
         openaiApiKey(openaiApiKey),
         aiPromptStyle(aiPromptStyle),
         city(city),
         countryCode(countryCode),
-        imageUrl(imageUrl) {}
+        imageUrl(imageUrl),
+        llmBaseUrl(llmBaseUrl),
+        llmModel(llmModel),
+        llmTimeoutSeconds(llmTimeoutSeconds) {}
 };
 
 using OnSaveCallback = std::function<void(const Configuration &config)>;
 
+enum ConfigurationExitReason { CONFIGURATION_SAVED, CONFIGURATION_BUTTON_PRESSED, CONFIGURATION_INACTIVE };
+
 class ConfigurationServer {
  public:
   ConfigurationServer(const Configuration &currentConfig);
+  ~ConfigurationServer();
+
   void run(OnSaveCallback onSaveCallback);
   void stop();
   bool isRunning() const;
-  void handleRequests();
+
+  ConfigurationExitReason waitForExit(int buttonPin, uint32_t inactivityTimeoutMillis);
 
   String getWifiAccessPointName() const;
   String getWifiAccessPointPassword() const;
@@ -55,16 +72,26 @@ class ConfigurationServer {
   DNSServer *dnsServer;
   bool isServerRunning;
 
-  String htmlTemplate;
+  EventGroupHandle_t events;
+  SemaphoreHandle_t dnsTaskDone;
+  volatile bool isDnsTaskRunning;
+  wifi_event_id_t stationConnectedEventId;
+  uint32_t previousCpuFrequencyMhz;
+
+  ConfigPageStream configurationPage;
+  Configuration savedConfiguration;
   OnSaveCallback onSaveCallback;
 
   void setupWebServer();
   void setupDNSServer();
-  String getConfigurationPage();
-  bool loadHtmlTemplate();
+  void recordClientActivity();
+  String getPlaceholderValue(const char *placeholder) const;
   void handleRoot(AsyncWebServerRequest *request);
   void handleSave(AsyncWebServerRequest *request);
   void handleNotFound(AsyncWebServerRequest *request);
+
+  static void dnsTask(void *parameter);
+  static void handleButtonInterrupt(void *parameter);
 };
 
 #endif
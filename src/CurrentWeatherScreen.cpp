@@ -1,5 +1,7 @@
 #include "CurrentWeatherScreen.h"
 
+#include "ApplicationConfig.h"
+#include "FrameHistory.h"
 #include "battery.h"
 
 CurrentWeatherScreen::CurrentWeatherScreen(DisplayType& display, const WeatherForecast& forecast,
@@ -10,13 +12,12 @@ CurrentWeatherScreen::CurrentWeatherScreen(DisplayType& display, const WeatherFo
       countryCode(countryCode),
       primaryFont(u8g2_font_helvB24_tf),
       mediumFont(u8g2_font_helvR12_tr),
-      smallFont(u8g2_font_helvR08_tr) {
+      smallFont(u8g2_font_helvR08_tr),
+      staticLayoutRendered(false) {
   gfx.begin(display);
 }
 
-void CurrentWeatherScreen::render() {
-  Serial.println("Displaying current weather screen");
-
+void CurrentWeatherScreen::renderStaticLayout() {
   display.init(115200);
   display.setRotation(1);
   display.fillScreen(GxEPD_WHITE);
@@ -24,13 +25,51 @@ void CurrentWeatherScreen::render() {
   gfx.setFontMode(1);
   gfx.setForegroundColor(GxEPD_BLACK);
   gfx.setBackgroundColor(GxEPD_WHITE);
+  gfx.setFont(smallFont);
 
-  if (forecast.lastUpdateTime.length() == 0) {
+  batteryStatus = getBatteryStatus();
+  int batteryWidth = gfx.getUTF8Width(batteryStatus.c_str());
+  gfx.setCursor(display.width() - batteryWidth - 2, display.height() - 2);
+  gfx.print(batteryStatus);
+
+  staticLayoutRendered = true;
+}
+
+uint32_t CurrentWeatherScreen::frameFingerprint() const {
+  uint32_t fingerprint = 0;
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.currentConditionsLocalTime,
+                                               sizeof(forecast.currentConditionsLocalTime));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.currentWeatherCode,
+                                               sizeof(forecast.currentWeatherCode));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.currentTemperatureTenthsCelsius,
+                                               sizeof(forecast.currentTemperatureTenthsCelsius));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.currentWindSpeedTenthsMps,
+                                               sizeof(forecast.currentWindSpeedTenthsMps));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.currentWindGustsTenthsMps,
+                                               sizeof(forecast.currentWindGustsTenthsMps));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, cityName);
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, countryCode);
+  return FrameHistory::addToFingerprint(fingerprint, batteryStatus);
+}
+
+void CurrentWeatherScreen::render() {
+  Serial.println("Displaying current weather screen");
+
+  if (!staticLayoutRendered) {
+    renderStaticLayout();
+  }
+
+  gfx.setFontMode(1);
+  gfx.setForegroundColor(GxEPD_BLACK);
+  gfx.setBackgroundColor(GxEPD_WHITE);
+
+  if (!forecast.isValid()) {
     Serial.println("Warning: Forecast data is invalid, displaying error message");
     gfx.setFont(smallFont);
     gfx.setCursor(10, 30);
     gfx.print("Weather data unavailable");
-    display.displayWindow(0, 0, display.width(), display.height());
+    FrameHistory frameHistory;
+    frameHistory.refresh(display);
     display.hibernate();
     return;
   }
@@ -39,13 +78,13 @@ void CurrentWeatherScreen::render() {
   int usableHeight = display.height() - topMargin;
 
   gfx.setFont(primaryFont);
-  String temperatureText = String(forecast.currentTemperature, 1) + " °C";
+  String temperatureText = String(forecast.currentTemperature(), 1) + " °C";
   int temperatureWidth = gfx.getUTF8Width(temperatureText.c_str());
   int temperatureAscent = gfx.getFontAscent();
   int temperatureDescent = gfx.getFontDescent();
 
   gfx.setFont(mediumFont);
-  String weatherDescription = forecast.currentWeatherCodeDescription;
+  String weatherDescription = forecast.currentWeatherDescription();
   int descriptionWidth = gfx.getUTF8Width(weatherDescription.c_str());
   int descriptionAscent = gfx.getFontAscent();
   int descriptionDescent = gfx.getFontDescent();
@@ -73,8 +112,10 @@ void CurrentWeatherScreen::render() {
   gfx.setFont(smallFont);
   int smallFontHeight = gfx.getFontAscent() - gfx.getFontDescent();
 
+  char lastUpdateTime[6];
+  WeatherForecast::formatTimeOfDay(forecast.currentConditionsLocalTime, lastUpdateTime, sizeof(lastUpdateTime));
   gfx.setCursor(2, topMargin + smallFontHeight + 2);
-  gfx.print(forecast.lastUpdateTime);
+  gfx.print(lastUpdateTime);
 
   String locationText = cityName;
   if (countryCode.length() > 0) {
@@ -85,16 +126,12 @@ void CurrentWeatherScreen::render() {
   gfx.setCursor(display.width() - locationWidth - 2, topMargin + smallFontHeight + 2);
   gfx.print(locationText);
 
-  String windText = String(forecast.currentWindSpeed, 1) + " - " + String(forecast.currentWindGusts, 1) + " m/s";
+  String windText = String(forecast.currentWindSpeed(), 1) + " - " + String(forecast.currentWindGusts(), 1) + " m/s";
   gfx.setCursor(2, display.height() - 2);
   gfx.print(windText);
 
-  String batteryStatus = getBatteryStatus();
-  int batteryWidth = gfx.getUTF8Width(batteryStatus.c_str());
-  gfx.setCursor(display.width() - batteryWidth - 2, display.height() - 2);
-  gfx.print(batteryStatus);
-
-  display.displayWindow(0, 0, display.width(), display.height());
+  FrameHistory frameHistory;
+  frameHistory.refreshIfChanged(display, CURRENT_WEATHER_SCREEN, frameFingerprint());
   display.hibernate();
   Serial.println("Current weather display updated");
 }
@@ -19,10 +19,16 @@ class CurrentWeatherScreen : public Screen {
   const uint8_t* mediumFont;
   const uint8_t* smallFont;
 
+  bool staticLayoutRendered;
+  String batteryStatus;
+
+  uint32_t frameFingerprint() const;
+
  public:
   CurrentWeatherScreen(DisplayType& display, const WeatherForecast& forecast, const String& cityName,
                        const String& countryCode);
 
+  void renderStaticLayout() override;
   void render() override;
   int nextRefreshInSeconds() override;
 };
@@ -0,0 +1,50 @@
+#include "DeviceState.h"
+
+#include <esp_attr.h>
+#include <math.h>
+
+#include "ApplicationConfig.h"
+
+RTC_DATA_ATTR static DeviceStateData deviceStateData;
+
+static DeviceStateData& initializedState() {
+  if (!deviceStateData.isInitialized) {
+    deviceStateData.currentScreenIndex = CURRENT_WEATHER_SCREEN;
+    deviceStateData.lastContentScreenIndex = CURRENT_WEATHER_SCREEN;
+    deviceStateData.latitude = NAN;
+    deviceStateData.longitude = NAN;
+    deviceStateData.wakeCount = 0;
+    deviceStateData.isInitialized = true;
+  }
+  return deviceStateData;
+}
+
+int DeviceState::currentScreenIndex() const { return initializedState().currentScreenIndex; }
+
+void DeviceState::setCurrentScreenIndex(int screenIndex) {
+  initializedState().currentScreenIndex = screenIndex;
+  if (screenIndex != CONFIG_SCREEN) {
+    deviceStateData.lastContentScreenIndex = screenIndex;
+  }
+}
+
+int DeviceState::lastContentScreenIndex() const { return initializedState().lastContentScreenIndex; }
+
+bool DeviceState::hasCoordinates() const {
+  return !isnan(initializedState().latitude) && !isnan(initializedState().longitude);
+}
+
+float DeviceState::latitude() const { return initializedState().latitude; }
+
+float DeviceState::longitude() const { return initializedState().longitude; }
+
+void DeviceState::setCoordinates(float latitude, float longitude) {
+  initializedState().latitude = latitude;
+  initializedState().longitude = longitude;
+}
+
+void DeviceState::clearCoordinates() { setCoordinates(NAN, NAN); }
+
+uint32_t DeviceState::wakeCount() const { return initializedState().wakeCount; }
+
+void DeviceState::recordWake() { initializedState().wakeCount++; }
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+
+struct DeviceStateData {
+  int32_t currentScreenIndex;
+  int32_t lastContentScreenIndex;
+  float latitude;
+  float longitude;
+  uint32_t wakeCount;
+  bool isInitialized;
+};
+
+class DeviceState {
+ public:
+  int currentScreenIndex() const;
+  void setCurrentScreenIndex(int screenIndex);
+  int lastContentScreenIndex() const;
+
+  bool hasCoordinates() const;
+  float latitude() const;
+  float longitude() const;
+  void setCoordinates(float latitude, float longitude);
+  void clearCoordinates();
+
+  uint32_t wakeCount() const;
+  void recordWake();
+};
@@ -0,0 +1,43 @@
+#include "DisplayPreparation.h"
+
+#include <Arduino.h>
+
+static const uint32_t PREPARE_DISPLAY_TASK_STACK_SIZE = 8192;
+
+DisplayPreparation::DisplayPreparation(Screen& screen)
+    : screen(screen), readySemaphore(xSemaphoreCreateBinary()), isReady(false) {
+  BaseType_t otherCore = xPortGetCoreID() == 0 ? 1 : 0;
+  BaseType_t taskCreated = xTaskCreatePinnedToCore(prepareDisplayTask, "prepareDisplay",
+                                                   PREPARE_DISPLAY_TASK_STACK_SIZE, this, 1, nullptr, otherCore);
+
+  if (taskCreated != pdPASS) {
+    Serial.println("Failed to start display preparation task, preparing display inline");
+    screen.renderStaticLayout();
+    isReady = true;
+  }
+}
+
+DisplayPreparation::~DisplayPreparation() {
+  waitUntilReady();
+  vSemaphoreDelete(readySemaphore);
+}
+
+void DisplayPreparation::prepareDisplayTask(void* parameter) {
+  DisplayPreparation* preparation = static_cast<DisplayPreparation*>(parameter);
+  uint32_t startedAtMillis = millis();
+
+  preparation->screen.renderStaticLayout();
+
+  Serial.printf("Display prepared on core %d in %lu ms\n", xPortGetCoreID(),
+                (unsigned long)(millis() - startedAtMillis));
+  xSemaphoreGive(preparation->readySemaphore);
+  vTaskDelete(nullptr);
+}
+
+void DisplayPreparation::waitUntilReady() {
+  if (isReady) {
+    return;
+  }
+  xSemaphoreTake(readySemaphore, portMAX_DELAY);
+  isReady = true;
+}
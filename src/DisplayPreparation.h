@@ -0,0 +1,25 @@
+#ifndef DISPLAY_PREPARATION_H
+#define DISPLAY_PREPARATION_H
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "Screen.h"
+
+class DisplayPreparation {
+ public:
+  DisplayPreparation(Screen& screen);
+  ~DisplayPreparation();
+
+  void waitUntilReady();
+
+ private:
+  Screen& screen;
+  SemaphoreHandle_t readySemaphore;
+  bool isReady;
+
+  static void prepareDisplayTask(void* parameter);
+};
+
+#endif
@@ -0,0 +1,61 @@
+#include "ForecastCache.h"
+
+#include <esp_attr.h>
+#include <math.h>
+
+RTC_DATA_ATTR static ForecastCacheEntry cachedForecastEntry;
+
+static const float LOCATION_TOLERANCE_DEGREES = 0.001f;
+
+bool ForecastCache::isEntryForLocation(const ForecastCacheEntry& entry, float latitude, float longitude) {
+  if (!entry.hasForecast || isnan(latitude) || isnan(longitude)) {
+    return false;
+  }
+  return fabsf(entry.latitude - latitude) < LOCATION_TOLERANCE_DEGREES &&
+         fabsf(entry.longitude - longitude) < LOCATION_TOLERANCE_DEGREES;
+}
+
+bool ForecastCache::isEntryFresh(const ForecastCacheEntry& entry, float latitude, float longitude, int64_t now,
+                                 uint32_t maxAgeSeconds) {
+  if (!isEntryForLocation(entry, latitude, longitude) || now < entry.fetchedAt) {
+    return false;
+  }
+
+  int64_t ageSeconds = now - entry.fetchedAt;
+  if (ageSeconds > maxAgeSeconds) {
+    return false;
+  }
+
+  const WeatherForecast& forecast = entry.forecast;
+  if (forecast.hourlyCount() == 0) {
+    return false;
+  }
+  int64_t lastHourlyTime = forecast.hourlyLocalTime(forecast.hourlyCount() - 1);
+  return forecast.currentLocalTime + ageSeconds <= lastHourlyTime;
+}
+
+WeatherForecast ForecastCache::advanceToNow(const ForecastCacheEntry& entry, int64_t now) {
+  WeatherForecast forecast = entry.forecast;
+  if (now > entry.fetchedAt) {
+    forecast.currentLocalTime += now - entry.fetchedAt;
+  }
+  return forecast;
+}
+
+bool ForecastCache::hasForecastFor(float latitude, float longitude) const {
+  return isEntryForLocation(cachedForecastEntry, latitude, longitude);
+}
+
+bool ForecastCache::isFresh(float latitude, float longitude, int64_t now, uint32_t maxAgeSeconds) const {
+  return isEntryFresh(cachedForecastEntry, latitude, longitude, now, maxAgeSeconds);
+}
+
+WeatherForecast ForecastCache::load(int64_t now) const { return advanceToNow(cachedForecastEntry, now); }
+
+void ForecastCache::store(const WeatherForecast& forecast, float latitude, float longitude, int64_t now) {
+  cachedForecastEntry.forecast = forecast;
+  cachedForecastEntry.fetchedAt = now;
+  cachedForecastEntry.latitude = latitude;
+  cachedForecastEntry.longitude = longitude;
+  cachedForecastEntry.hasForecast = true;
+}
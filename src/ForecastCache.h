@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "WeatherForecast.h"
+
+struct ForecastCacheEntry {
+  WeatherForecast forecast;
+  int64_t fetchedAt;
+  float latitude;
+  float longitude;
+  bool hasForecast;
+};
+
+class ForecastCache {
+ public:
+  bool hasForecastFor(float latitude, float longitude) const;
+  bool isFresh(float latitude, float longitude, int64_t now, uint32_t maxAgeSeconds) const;
+  WeatherForecast load(int64_t now) const;
+  void store(const WeatherForecast& forecast, float latitude, float longitude, int64_t now);
+
+  static bool isEntryForLocation(const ForecastCacheEntry& entry, float latitude, float longitude);
+  static bool isEntryFresh(const ForecastCacheEntry& entry, float latitude, float longitude, int64_t now,
+                           uint32_t maxAgeSeconds);
+  static WeatherForecast advanceToNow(const ForecastCacheEntry& entry, int64_t now);
+};
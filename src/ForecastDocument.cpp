@@ -0,0 +1,74 @@
+#include "ForecastDocument.h"
+
+#include <algorithm>
+
+ForecastDocument::ForecastDocument(size_t capacity) : doc(capacity) {
+  filter["utc_offset_seconds"] = true;
+  JsonObject currentFilter = filter.createNestedObject("current");
+  currentFilter["time"] = true;
+  currentFilter["temperature_2m"] = true;
+  currentFilter["weather_code"] = true;
+  currentFilter["wind_speed_10m"] = true;
+  currentFilter["wind_gusts_10m"] = true;
+  currentFilter["wind_direction_10m"] = true;
+  JsonObject hourlyFilter = filter.createNestedObject("hourly");
+  hourlyFilter["time"] = true;
+  hourlyFilter["temperature_2m"] = true;
+  hourlyFilter["precipitation"] = true;
+  hourlyFilter["wind_speed_10m"] = true;
+  hourlyFilter["wind_gusts_10m"] = true;
+  hourlyFilter["cloud_cover_low"] = true;
+}
+
+DeserializationError ForecastDocument::parse(Stream& stream) {
+  return deserializeJson(doc, stream, DeserializationOption::Filter(filter));
+}
+
+DeserializationError ForecastDocument::parse(const char* json) {
+  return deserializeJson(doc, json, DeserializationOption::Filter(filter));
+}
+
+void ForecastDocument::fill(WeatherForecast& forecast) const {
+  JsonObjectConst current = doc["current"];
+  forecast.currentTemperatureTenthsCelsius = WeatherForecast::toSignedTenths(current["temperature_2m"].as<float>());
+  forecast.currentWeatherCode = current["weather_code"].as<uint8_t>();
+  forecast.currentWindSpeedTenthsMps = WeatherForecast::toUnsignedTenths(current["wind_speed_10m"].as<float>() / 3.6f);
+  forecast.currentWindGustsTenthsMps = WeatherForecast::toUnsignedTenths(current["wind_gusts_10m"].as<float>() / 3.6f);
+  forecast.currentWindDirectionDegrees = current["wind_direction_10m"].as<uint16_t>();
+  forecast.utcOffsetSeconds = doc["utc_offset_seconds"].as<int32_t>();
+
+  JsonObjectConst hourly = doc["hourly"];
+  JsonArrayConst hourlyTimes = hourly["time"].as<JsonArrayConst>();
+  JsonArrayConst hourlyTemperatures = hourly["temperature_2m"].as<JsonArrayConst>();
+  JsonArrayConst hourlyWindSpeeds = hourly["wind_speed_10m"].as<JsonArrayConst>();
+  JsonArrayConst hourlyWindGusts = hourly["wind_gusts_10m"].as<JsonArrayConst>();
+  JsonArrayConst hourlyPrecipitation = hourly["precipitation"].as<JsonArrayConst>();
+  JsonArrayConst hourlyCloudCoverage = hourly["cloud_cover_low"].as<JsonArrayConst>();
+
+  size_t hourlyPointCount = std::min({hourlyTimes.size(), hourlyTemperatures.size(), hourlyWindSpeeds.size(),
+                                      hourlyWindGusts.size(), hourlyPrecipitation.size(), hourlyCloudCoverage.size(),
+                                      (size_t)WeatherForecast::MAX_HOURLY_POINTS});
+
+  if (hourlyPointCount > 0) {
+    forecast.hourlyStartLocalTime = WeatherForecast::parseLocalTime(hourlyTimes[0].as<const char*>());
+    forecast.hourlyStepSeconds = 3600;
+  }
+  if (hourlyPointCount > 1) {
+    int64_t secondTime = WeatherForecast::parseLocalTime(hourlyTimes[1].as<const char*>());
+    forecast.hourlyStepSeconds = (uint16_t)(secondTime - forecast.hourlyStartLocalTime);
+  }
+
+  for (size_t i = 0; i < hourlyPointCount; i++) {
+    forecast.hourlyTemperatureTenthsCelsius[i] = WeatherForecast::toSignedTenths(hourlyTemperatures[i].as<float>());
+    forecast.hourlyWindSpeedTenthsMps[i] = WeatherForecast::toUnsignedTenths(hourlyWindSpeeds[i].as<float>() / 3.6f);
+    forecast.hourlyWindGustsTenthsMps[i] = WeatherForecast::toUnsignedTenths(hourlyWindGusts[i].as<float>() / 3.6f);
+    forecast.hourlyPrecipitationTenthsMm[i] = WeatherForecast::toUnsignedTenths(hourlyPrecipitation[i].as<float>());
+    forecast.hourlyCloudCoveragePercent[i] = WeatherForecast::toPercent(hourlyCloudCoverage[i].as<float>());
+  }
+  forecast.hourlyPointCount = (uint8_t)hourlyPointCount;
+
+  forecast.currentConditionsLocalTime = WeatherForecast::parseLocalTime(current["time"].as<const char*>());
+  forecast.currentLocalTime = forecast.currentConditionsLocalTime;
+}
+
+size_t ForecastDocument::memoryUsage() const { return doc.memoryUsage(); }
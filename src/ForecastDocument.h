@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "WeatherForecast.h"
+
+class ForecastDocument {
+ public:
+  static const size_t DEFAULT_CAPACITY = 8192;
+
+  explicit ForecastDocument(size_t capacity = DEFAULT_CAPACITY);
+
+  DeserializationError parse(Stream& stream);
+  DeserializationError parse(const char* json);
+  void fill(WeatherForecast& forecast) const;
+  size_t memoryUsage() const;
+
+ private:
+  StaticJsonDocument<512> filter;
+  DynamicJsonDocument doc;
+};
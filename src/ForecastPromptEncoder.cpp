@@ -0,0 +1,52 @@
+#include "ForecastPromptEncoder.h"
+
+#include <stdio.h>
+
+static int formatTenths(char* buffer, size_t bufferSize, int value) {
+  const char* sign = value < 0 ? "-" : "";
+  int magnitude = value < 0 ? -value : value;
+  return snprintf(buffer, bufferSize, "%s%d.%d", sign, magnitude / 10, magnitude % 10);
+}
+
+size_t ForecastPromptEncoder::encode(const WeatherForecast& forecast, char* buffer, size_t bufferSize) {
+  if (bufferSize == 0) {
+    return 0;
+  }
+
+  size_t length = 0;
+  auto append = [&](int written) {
+    if (written > 0) {
+      length = length + written < bufferSize ? length + written : bufferSize - 1;
+    }
+  };
+
+  char currentTime[6];
+  WeatherForecast::formatTimeOfDay(forecast.currentLocalTime, currentTime, sizeof(currentTime));
+  append(snprintf(buffer + length, bufferSize - length, "Now %s: ", currentTime));
+  append(formatTenths(buffer + length, bufferSize - length, forecast.currentTemperatureTenthsCelsius));
+  append(snprintf(buffer + length, bufferSize - length, "C, %s, wind ", forecast.currentWeatherDescription()));
+  append(formatTenths(buffer + length, bufferSize - length, forecast.currentWindSpeedTenthsMps));
+  append(snprintf(buffer + length, bufferSize - length, " gusts "));
+  append(formatTenths(buffer + length, bufferSize - length, forecast.currentWindGustsTenthsMps));
+  append(snprintf(buffer + length, bufferSize - length, " m/s\nhour|temp C|rain mm|wind m/s|gust m/s|cloud %%\n"));
+
+  int64_t localDay = forecast.currentLocalTime / 86400;
+  for (int i = 0; i < forecast.hourlyCount(); i++) {
+    int64_t hourTime = forecast.hourlyLocalTime(i);
+    if (hourTime / 86400 != localDay || hourTime + forecast.hourlyStepSeconds <= forecast.currentLocalTime) {
+      continue;
+    }
+
+    append(snprintf(buffer + length, bufferSize - length, "%02d|", WeatherForecast::minutesOfDay(hourTime) / 60));
+    append(formatTenths(buffer + length, bufferSize - length, forecast.hourlyTemperatureTenthsCelsius[i]));
+    append(snprintf(buffer + length, bufferSize - length, "|"));
+    append(formatTenths(buffer + length, bufferSize - length, forecast.hourlyPrecipitationTenthsMm[i]));
+    append(snprintf(buffer + length, bufferSize - length, "|"));
+    append(formatTenths(buffer + length, bufferSize - length, forecast.hourlyWindSpeedTenthsMps[i]));
+    append(snprintf(buffer + length, bufferSize - length, "|"));
+    append(formatTenths(buffer + length, bufferSize - length, forecast.hourlyWindGustsTenthsMps[i]));
+    append(snprintf(buffer + length, bufferSize - length, "|%d\n", forecast.hourlyCloudCoveragePercent[i]));
+  }
+
+  return length;
+}
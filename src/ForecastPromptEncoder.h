@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "WeatherForecast.h"
+
+class ForecastPromptEncoder {
+ public:
+  static const size_t MAX_ENCODED_LENGTH = 1024;
+
+  static size_t encode(const WeatherForecast& forecast, char* buffer, size_t bufferSize);
+};
@@ -0,0 +1,52 @@
+#include "FrameHistory.h"
+
+#include <esp_attr.h>
+#include <rom/crc.h>
+
+RTC_DATA_ATTR static DisplayedFrame displayedFrame;
+
+uint32_t FrameHistory::addToFingerprint(uint32_t fingerprint, const void* data, size_t length) {
+  return crc32_le(fingerprint, static_cast<const uint8_t*>(data), length);
+}
+
+uint32_t FrameHistory::addToFingerprint(uint32_t fingerprint, const String& text) {
+  return addToFingerprint(fingerprint, text.c_str(), text.length() + 1);
+}
+
+bool FrameHistory::isDisplaying(int screenIndex) const {
+  return displayedFrame.isValid && displayedFrame.screenIndex == screenIndex;
+}
+
+bool FrameHistory::isDisplayed(int screenIndex, uint32_t fingerprint) const {
+  return isDisplaying(screenIndex) && displayedFrame.fingerprint == fingerprint;
+}
+
+void FrameHistory::recordDisplayed(int screenIndex, uint32_t fingerprint) {
+  displayedFrame.screenIndex = screenIndex;
+  displayedFrame.fingerprint = fingerprint;
+  displayedFrame.isValid = true;
+}
+
+void FrameHistory::recordSkippedRefresh() {
+  displayedFrame.skippedRefreshCount++;
+  Serial.printf("Frame unchanged, skipping display refresh (%lu skipped so far)\n",
+                (unsigned long)displayedFrame.skippedRefreshCount);
+}
+
+bool FrameHistory::refreshIfChanged(DisplayType& display, int screenIndex, uint32_t fingerprint) {
+  if (isDisplayed(screenIndex, fingerprint)) {
+    recordSkippedRefresh();
+    return false;
+  }
+
+  display.displayWindow(0, 0, display.width(), display.height());
+  recordDisplayed(screenIndex, fingerprint);
+  return true;
+}
+
+void FrameHistory::refresh(DisplayType& display) {
+  display.displayWindow(0, 0, display.width(), display.height());
+  displayedFrame.isValid = false;
+}
+
+uint32_t FrameHistory::skippedRefreshCount() const { return displayedFrame.skippedRefreshCount; }
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include "DisplayType.h"
+
+struct DisplayedFrame {
+  int32_t screenIndex;
+  uint32_t fingerprint;
+  uint32_t skippedRefreshCount;
+  bool isValid;
+};
+
+class FrameHistory {
+ public:
+  bool refreshIfChanged(DisplayType& display, int screenIndex, uint32_t fingerprint);
+  void refresh(DisplayType& display);
+
+  bool isDisplaying(int screenIndex) const;
+  bool isDisplayed(int screenIndex, uint32_t fingerprint) const;
+  void recordDisplayed(int screenIndex, uint32_t fingerprint);
+  void recordSkippedRefresh();
+  uint32_t skippedRefreshCount() const;
+
+  static uint32_t addToFingerprint(uint32_t fingerprint, const void* data, size_t length);
+  static uint32_t addToFingerprint(uint32_t fingerprint, const String& text);
+};
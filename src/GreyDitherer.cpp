@@ -0,0 +1,48 @@
+#include "GreyDitherer.h"
+
+#include <string.h>
+
+GreyDitherer::GreyDitherer(uint16_t width)
+    : width(width), currentRowErrors(new int16_t[width + 2]), nextRowErrors(new int16_t[width + 2]) {
+  memset(currentRowErrors, 0, (width + 2) * sizeof(int16_t));
+  memset(nextRowErrors, 0, (width + 2) * sizeof(int16_t));
+}
+
+GreyDitherer::~GreyDitherer() {
+  delete[] currentRowErrors;
+  delete[] nextRowErrors;
+}
+
+uint8_t GreyDitherer::nearestLevel(int16_t luminance) {
+  if (luminance <= 0) {
+    return 0;
+  }
+  if (luminance >= 255) {
+    return GREY_LEVELS - 1;
+  }
+  return (luminance * (GREY_LEVELS - 1) + 127) / 255;
+}
+
+int16_t GreyDitherer::levelLuminance(uint8_t level) { return level * 255 / (GREY_LEVELS - 1); }
+
+void GreyDitherer::ditherRow(const uint8_t* luminanceRow, uint8_t* packedRow) {
+  memset(packedRow, 0, (width + 3) / 4);
+
+  for (uint16_t x = 0; x < width; x++) {
+    int16_t value = luminanceRow[x] + (currentRowErrors[x + 1] >> 4);
+    uint8_t level = nearestLevel(value);
+    int16_t error = value - levelLuminance(level);
+
+    currentRowErrors[x + 2] += error * 7;
+    nextRowErrors[x] += error * 3;
+    nextRowErrors[x + 1] += error * 5;
+    nextRowErrors[x + 2] += error;
+
+    packedRow[x / 4] |= level << (6 - (x % 4) * 2);
+  }
+
+  int16_t* finishedRowErrors = currentRowErrors;
+  currentRowErrors = nextRowErrors;
+  nextRowErrors = finishedRowErrors;
+  memset(nextRowErrors, 0, (width + 2) * sizeof(int16_t));
+}
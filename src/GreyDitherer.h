@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stdint.h>
+
+class GreyDitherer {
+ public:
+  static const uint8_t GREY_LEVELS = 4;
+
+  explicit GreyDitherer(uint16_t width);
+  ~GreyDitherer();
+
+  void ditherRow(const uint8_t* luminanceRow, uint8_t* packedRow);
+
+  static uint8_t nearestLevel(int16_t luminance);
+  static int16_t levelLuminance(uint8_t level);
+
+ private:
+  uint16_t width;
+  int16_t* currentRowErrors;
+  int16_t* nextRowErrors;
+
+  GreyDitherer(const GreyDitherer&) = delete;
+  GreyDitherer& operator=(const GreyDitherer&) = delete;
+};
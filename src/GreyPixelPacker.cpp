@@ -0,0 +1,44 @@
+#include "GreyPixelPacker.h"
+
+#include <string.h>
+
+#include "GreyDitherer.h"
+
+static const uint8_t GREY_LEVEL_TOLERANCE = 2;
+
+GreyPixelPacker::GreyPixelPacker() : hasOnlyGreyLevels(true) { memset(levelByIndex, 0, sizeof(levelByIndex)); }
+
+uint8_t GreyPixelPacker::exactGreyLevel(uint8_t luminance) {
+  uint8_t level = GreyDitherer::nearestLevel(luminance);
+  int16_t difference = luminance - GreyDitherer::levelLuminance(level);
+  return difference <= GREY_LEVEL_TOLERANCE && difference >= -GREY_LEVEL_TOLERANCE ? level : NOT_A_GREY_LEVEL;
+}
+
+void GreyPixelPacker::setPaletteEntry(uint8_t index, uint8_t luminance) {
+  uint8_t level = exactGreyLevel(luminance);
+  if (level == NOT_A_GREY_LEVEL) {
+    hasOnlyGreyLevels = false;
+    level = GreyDitherer::nearestLevel(luminance);
+  }
+  levelByIndex[index] = level;
+}
+
+void GreyPixelPacker::packRow(const uint8_t* indexedRow, uint32_t width, uint8_t* packedRow) const {
+  uint32_t wholeBytes = width / 4;
+
+  for (uint32_t i = 0; i < wholeBytes; i++) {
+    uint32_t word;
+    memcpy(&word, indexedRow + i * 4, sizeof(word));
+    packedRow[i] = (levelByIndex[word & 0xFF] << 6) | (levelByIndex[(word >> 8) & 0xFF] << 4) |
+                   (levelByIndex[(word >> 16) & 0xFF] << 2) | levelByIndex[word >> 24];
+  }
+
+  uint32_t remainder = width % 4;
+  if (remainder > 0) {
+    uint8_t tail = 0;
+    for (uint32_t x = 0; x < remainder; x++) {
+      tail |= levelByIndex[indexedRow[wholeBytes * 4 + x]] << (6 - x * 2);
+    }
+    packedRow[wholeBytes] = tail;
+  }
+}
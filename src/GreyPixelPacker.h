@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class GreyPixelPacker {
+ public:
+  static const uint8_t NOT_A_GREY_LEVEL = 0xFF;
+
+  GreyPixelPacker();
+
+  void setPaletteEntry(uint8_t index, uint8_t luminance);
+  bool isExactGreyPalette() const { return hasOnlyGreyLevels; }
+  void packRow(const uint8_t* indexedRow, uint32_t width, uint8_t* packedRow) const;
+
+  static uint8_t exactGreyLevel(uint8_t luminance);
+
+ private:
+  uint8_t levelByIndex[256];
+  bool hasOnlyGreyLevels;
+};
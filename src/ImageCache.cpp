@@ -0,0 +1,120 @@
+#include "ImageCache.h"
+
+#include <SPIFFS.h>
+
+static const uint32_t IMAGE_CACHE_MAGIC = 0x32475049;
+
+ImageCache::ImageCache(const char* path, const char* tempPath)
+    : path(path), tempPath(tempPath), isMounted(false), hasWriteError(false) {}
+
+bool ImageCache::mount() {
+  if (!isMounted) {
+    isMounted = SPIFFS.begin(true);
+    if (!isMounted) {
+      Serial.println("SPIFFS Mount Failed - image cache unavailable");
+    }
+  }
+  return isMounted;
+}
+
+bool ImageCache::readHeader(File& file, const String& etag, ImageCacheHeader& header) {
+  if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+    return false;
+  }
+  header.etag[sizeof(header.etag) - 1] = '\0';
+  return header.magic == IMAGE_CACHE_MAGIC && etag == header.etag && header.layout.width > 0 &&
+         header.layout.height > 0;
+}
+
+bool ImageCache::contains(const String& etag) {
+  if (etag.isEmpty() || !mount() || !SPIFFS.exists(path)) {
+    return false;
+  }
+
+  File file = SPIFFS.open(path, "r");
+  ImageCacheHeader header;
+  bool isMatch = file && readHeader(file, etag, header);
+  file.close();
+  return isMatch;
+}
+
+bool ImageCache::draw(DisplayType& display, const String& etag) {
+  if (!mount()) {
+    return false;
+  }
+
+  File file = SPIFFS.open(path, "r");
+  ImageCacheHeader header;
+  if (!file || !readHeader(file, etag, header)) {
+    Serial.println("Cached image missing or stale for ETag: " + etag);
+    file.close();
+    return false;
+  }
+
+  const ImageLayout& layout = header.layout;
+  size_t rowBytes = (layout.width + 3) / 4;
+  uint8_t* packedRow = new uint8_t[rowBytes];
+
+  bool isComplete = true;
+  for (int16_t row = 0; row < layout.height; row++) {
+    if (file.read(packedRow, rowBytes) != rowBytes) {
+      Serial.printf("Cached image truncated at row %d of %d\n", row, layout.height);
+      isComplete = false;
+      break;
+    }
+    int16_t y = layout.isBottomUp ? layout.height - 1 - row : row;
+    display.drawGreyPixmap(packedRow, 2, layout.x, layout.y + y, layout.width, 1);
+  }
+
+  delete[] packedRow;
+  file.close();
+  return isComplete;
+}
+
+bool ImageCache::beginWrite(const String& etag, const ImageLayout& layout) {
+  if (etag.isEmpty() || etag.length() >= sizeof(ImageCacheHeader::etag) || !mount()) {
+    return false;
+  }
+
+  writeFile = SPIFFS.open(tempPath, "w");
+  if (!writeFile) {
+    Serial.println("Failed to open image cache for writing");
+    return false;
+  }
+
+  ImageCacheHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = IMAGE_CACHE_MAGIC;
+  strncpy(header.etag, etag.c_str(), sizeof(header.etag) - 1);
+  header.layout = layout;
+
+  hasWriteError = writeFile.write((const uint8_t*)&header, sizeof(header)) != sizeof(header);
+  return !hasWriteError;
+}
+
+void ImageCache::writeRow(const uint8_t* packedRow, size_t length) {
+  if (writeFile && !hasWriteError) {
+    hasWriteError = writeFile.write(packedRow, length) != length;
+  }
+}
+
+bool ImageCache::finishWrite(bool isComplete) {
+  if (!writeFile) {
+    return false;
+  }
+  writeFile.close();
+
+  if (!isComplete || hasWriteError) {
+    Serial.println("Discarding incomplete image cache entry");
+    SPIFFS.remove(tempPath);
+    return false;
+  }
+
+  SPIFFS.remove(path);
+  if (!SPIFFS.rename(tempPath, path)) {
+    Serial.println("Failed to commit image cache entry");
+    return false;
+  }
+  Serial.println("Image cached to flash");
+  return true;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <Arduino.h>
+#include <FS.h>
+
+#include "DisplayType.h"
+
+struct ImageLayout {
+  int16_t x;
+  int16_t y;
+  int16_t width;
+  int16_t height;
+  bool isBottomUp;
+};
+
+struct ImageCacheHeader {
+  uint32_t magic;
+  char etag[128];
+  ImageLayout layout;
+};
+
+class ImageCache {
+ public:
+  ImageCache(const char* path = "/image.bin", const char* tempPath = "/image.tmp");
+
+  bool contains(const String& etag);
+  bool draw(DisplayType& display, const String& etag);
+
+  bool beginWrite(const String& etag, const ImageLayout& layout);
+  void writeRow(const uint8_t* packedRow, size_t length);
+  bool finishWrite(bool isComplete);
+
+ private:
+  const char* path;
+  const char* tempPath;
+  File writeFile;
+  bool isMounted;
+  bool hasWriteError;
+
+  bool mount();
+  bool readHeader(File& file, const String& etag, ImageCacheHeader& header);
+};
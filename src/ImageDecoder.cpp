@@ -0,0 +1,78 @@
+#include "ImageDecoder.h"
+
+#include "BmpStreamDecoder.h"
+#include "JpegStreamDecoder.h"
+#include "PackedImageDecoder.h"
+
+const char* ImageDecoder::ACCEPT_HEADER = "application/x-grey2, image/bmp;q=0.5, image/jpeg;q=0.4";
+
+ImageDecoder::ImageDecoder(Stream& stream, DisplayType& display)
+    : stream(stream), display(display), bytesConsumed(0), drawsToDisplay(true) {}
+
+std::unique_ptr<ImageDecoder> ImageDecoder::create(const String& contentType, Stream& stream, DisplayType& display) {
+  String type = contentType;
+  type.toLowerCase();
+
+  if (type == PackedImageDecoder::CONTENT_TYPE) {
+    return std::unique_ptr<ImageDecoder>(new PackedImageDecoder(stream, display));
+  }
+  if (type.isEmpty() || type == "image/bmp" || type == "image/x-ms-bmp" || type == "application/octet-stream") {
+    return std::unique_ptr<ImageDecoder>(new BmpStreamDecoder(stream, display));
+  }
+  if (type == "image/jpeg" || type == "image/jpg") {
+    return std::unique_ptr<ImageDecoder>(new JpegStreamDecoder(stream, display));
+  }
+
+  Serial.println("Unsupported content type: " + contentType);
+  return nullptr;
+}
+
+uint16_t ImageDecoder::readUint16(const uint8_t* data) { return data[0] | (data[1] << 8); }
+
+uint32_t ImageDecoder::readUint32(const uint8_t* data) {
+  return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+uint8_t ImageDecoder::luminance(uint8_t red, uint8_t green, uint8_t blue) {
+  return (red * 77 + green * 150 + blue * 29) >> 8;
+}
+
+void ImageDecoder::fitWithin(uint32_t sourceWidth, uint32_t sourceHeight, int16_t targetWidth, int16_t targetHeight,
+                             int16_t& scaledWidth, int16_t& scaledHeight) {
+  scaledWidth = targetWidth;
+  scaledHeight = (uint64_t)sourceHeight * targetWidth / sourceWidth;
+  if (scaledHeight > targetHeight) {
+    scaledHeight = targetHeight;
+    scaledWidth = (uint64_t)sourceWidth * targetHeight / sourceHeight;
+  }
+  scaledWidth = max<int16_t>(scaledWidth, 1);
+  scaledHeight = max<int16_t>(scaledHeight, 1);
+}
+
+bool ImageDecoder::readFully(uint8_t* buffer, size_t length) {
+  size_t bytesRead = stream.readBytes(buffer, length);
+  bytesConsumed += bytesRead;
+  return bytesRead == length;
+}
+
+void ImageDecoder::emitRow(const ImageLayout& layout, int16_t y, const uint8_t* packedRow, size_t length,
+                           ImageCache* cache) {
+  if (drawsToDisplay) {
+    display.drawGreyPixmap(packedRow, 2, layout.x, layout.y + y, layout.width, 1);
+  }
+  if (cache) {
+    cache->writeRow(packedRow, length);
+  }
+}
+
+bool ImageDecoder::skip(size_t length) {
+  uint8_t discard[32];
+  while (length > 0) {
+    size_t chunk = length < sizeof(discard) ? length : sizeof(discard);
+    if (!readFully(discard, chunk)) {
+      return false;
+    }
+    length -= chunk;
+  }
+  return true;
+}
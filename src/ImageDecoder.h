@@ -0,0 +1,39 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <memory>
+
+#include "DisplayType.h"
+#include "ImageCache.h"
+
+class ImageDecoder {
+ public:
+  ImageDecoder(Stream& stream, DisplayType& display);
+  virtual ~ImageDecoder() {}
+
+  virtual bool readHeader() = 0;
+  virtual ImageLayout layoutFor(int16_t targetWidth, int16_t targetHeight) const = 0;
+  virtual bool draw(const ImageLayout& layout, ImageCache* cache) = 0;
+
+  void setDrawsToDisplay(bool drawsToDisplay) { this->drawsToDisplay = drawsToDisplay; }
+
+  static const char* ACCEPT_HEADER;
+
+  static std::unique_ptr<ImageDecoder> create(const String& contentType, Stream& stream, DisplayType& display);
+  static uint16_t readUint16(const uint8_t* data);
+  static uint32_t readUint32(const uint8_t* data);
+  static uint8_t luminance(uint8_t red, uint8_t green, uint8_t blue);
+  static void fitWithin(uint32_t sourceWidth, uint32_t sourceHeight, int16_t targetWidth, int16_t targetHeight,
+                        int16_t& scaledWidth, int16_t& scaledHeight);
+
+ protected:
+  Stream& stream;
+  DisplayType& display;
+  uint32_t bytesConsumed;
+  bool drawsToDisplay;
+
+  bool readFully(uint8_t* buffer, size_t length);
+  bool skip(size_t length);
+  void emitRow(const ImageLayout& layout, int16_t y, const uint8_t* packedRow, size_t length, ImageCache* cache);
+};
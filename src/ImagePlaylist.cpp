@@ -0,0 +1,110 @@
+#include "ImagePlaylist.h"
+
+#include <HTTPClient.h>
+
+#include "FrameHistory.h"
+
+const char* ImagePlaylist::PREFETCH_CACHE_PATH = "/next.bin";
+const char* ImagePlaylist::PREFETCH_CACHE_TEMP_PATH = "/next.tmp";
+
+RTC_DATA_ATTR static ImagePlaylistState imagePlaylistState;
+
+ImagePlaylist::ImagePlaylist(const char* source)
+    : source(source), sourceHash(FrameHistory::addToFingerprint(0, this->source)) {
+  if (imagePlaylistState.sourceHash != sourceHash) {
+    imagePlaylistState = {sourceHash, 0, 0, false};
+  }
+}
+
+bool ImagePlaylist::isManifestUrl(const String& url) {
+  int queryStart = url.indexOf('?');
+  String path = queryStart >= 0 ? url.substring(0, queryStart) : url;
+  path.toLowerCase();
+  return path.endsWith(".txt");
+}
+
+void ImagePlaylist::addUrls(const String& text) {
+  int start = 0;
+  while (start < (int)text.length() && urls.size() < MAX_IMAGES) {
+    int end = start;
+    while (end < (int)text.length() && !isspace((unsigned char)text[end])) {
+      end++;
+    }
+    if (end > start && text[start] != '#') {
+      urls.push_back(text.substring(start, end));
+    } else if (end > start) {
+      while (end < (int)text.length() && text[end] != '\n') {
+        end++;
+      }
+    }
+    start = end + 1;
+  }
+}
+
+bool ImagePlaylist::fetchManifest(const String& manifestUrl) {
+  HTTPClient http;
+  http.begin(manifestUrl);
+  http.setTimeout(10000);
+
+  int httpCode = http.GET();
+  if (httpCode != HTTP_CODE_OK) {
+    Serial.printf("Playlist manifest request failed with code: %d\n", httpCode);
+    http.end();
+    return false;
+  }
+
+  if (http.getSize() > MAX_MANIFEST_BYTES) {
+    Serial.printf("Playlist manifest too large: %d bytes\n", http.getSize());
+    http.end();
+    return false;
+  }
+
+  addUrls(http.getString());
+  http.end();
+  return true;
+}
+
+bool ImagePlaylist::load() {
+  urls.clear();
+  addUrls(source);
+
+  if (urls.size() == 1 && isManifestUrl(urls[0])) {
+    String manifestUrl = urls[0];
+    urls.clear();
+    if (!fetchManifest(manifestUrl)) {
+      return false;
+    }
+  }
+
+  if (urls.empty()) {
+    Serial.println("Image playlist is empty");
+    return false;
+  }
+
+  imagePlaylistState.position %= urls.size();
+  Serial.printf("Image playlist: showing %u of %u\n", currentPosition() + 1, (unsigned)urls.size());
+  return true;
+}
+
+uint16_t ImagePlaylist::currentPosition() const { return imagePlaylistState.position % urls.size(); }
+
+uint16_t ImagePlaylist::nextPosition() const { return (currentPosition() + 1) % urls.size(); }
+
+String ImagePlaylist::cacheKey(uint16_t position) const { return String(sourceHash, HEX) + ":" + String(position); }
+
+bool ImagePlaylist::hasPrefetchedImage() const {
+  return imagePlaylistState.hasPrefetchedImage && imagePlaylistState.prefetchedPosition == imagePlaylistState.position;
+}
+
+String ImagePlaylist::prefetchedCacheKey() const { return cacheKey(imagePlaylistState.prefetchedPosition); }
+
+void ImagePlaylist::recordPrefetched(uint16_t position) {
+  imagePlaylistState.prefetchedPosition = position;
+  imagePlaylistState.hasPrefetchedImage = true;
+}
+
+void ImagePlaylist::discardPrefetched() { imagePlaylistState.hasPrefetchedImage = false; }
+
+void ImagePlaylist::advance() {
+  imagePlaylistState.position = urls.empty() ? imagePlaylistState.position + 1 : nextPosition();
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <vector>
+
+struct ImagePlaylistState {
+  uint32_t sourceHash;
+  uint16_t position;
+  uint16_t prefetchedPosition;
+  bool hasPrefetchedImage;
+};
+
+class ImagePlaylist {
+ public:
+  static const size_t MAX_IMAGES = 32;
+  static const int MAX_MANIFEST_BYTES = 4096;
+  static const char* PREFETCH_CACHE_PATH;
+  static const char* PREFETCH_CACHE_TEMP_PATH;
+
+  explicit ImagePlaylist(const char* source);
+
+  bool load();
+  size_t count() const { return urls.size(); }
+  const String& currentUrl() const { return urls[currentPosition()]; }
+  const String& nextUrl() const { return urls[nextPosition()]; }
+  uint16_t currentPosition() const;
+  uint16_t nextPosition() const;
+  String cacheKey(uint16_t position) const;
+
+  bool hasPrefetchedImage() const;
+  String prefetchedCacheKey() const;
+  void recordPrefetched(uint16_t position);
+  void discardPrefetched();
+  void advance();
+
+  static bool isManifestUrl(const String& url);
+
+ private:
+  String source;
+  uint32_t sourceHash;
+  std::vector<String> urls;
+
+  void addUrls(const String& text);
+  bool fetchManifest(const String& manifestUrl);
+};
@@ -0,0 +1,95 @@
+#include "ImagePrefetch.h"
+
+#include <HTTPClient.h>
+
+#include "ImageCache.h"
+#include "ImageDecoder.h"
+#include "ImagePlaylist.h"
+
+static const uint32_t PREFETCH_TASK_STACK_SIZE = 16384;
+
+ImagePrefetch::ImagePrefetch(DisplayType& display, const String& url, const String& cacheKey, int16_t targetWidth,
+                             int16_t targetHeight)
+    : display(display),
+      url(url),
+      cacheKey(cacheKey),
+      targetWidth(targetWidth),
+      targetHeight(targetHeight),
+      doneSemaphore(xSemaphoreCreateBinary()),
+      isDone(false),
+      isCached(false) {
+  BaseType_t otherCore = xPortGetCoreID() == 0 ? 1 : 0;
+  BaseType_t taskCreated =
+      xTaskCreatePinnedToCore(prefetchTask, "prefetchImage", PREFETCH_TASK_STACK_SIZE, this, 1, nullptr, otherCore);
+
+  if (taskCreated != pdPASS) {
+    Serial.println("Failed to start image prefetch task, skipping prefetch");
+    isDone = true;
+  }
+}
+
+ImagePrefetch::~ImagePrefetch() {
+  waitUntilDone();
+  vSemaphoreDelete(doneSemaphore);
+}
+
+void ImagePrefetch::prefetchTask(void* parameter) {
+  ImagePrefetch* prefetch = static_cast<ImagePrefetch*>(parameter);
+  uint32_t startedAtMillis = millis();
+
+  prefetch->isCached = prefetch->downloadToCache();
+
+  Serial.printf("Image prefetch %s on core %d in %lu ms\n", prefetch->isCached ? "cached" : "failed",
+                xPortGetCoreID(), (unsigned long)(millis() - startedAtMillis));
+  xSemaphoreGive(prefetch->doneSemaphore);
+  vTaskDelete(nullptr);
+}
+
+bool ImagePrefetch::downloadToCache() {
+  HTTPClient http;
+
+  Serial.println("Prefetching image from: " + url);
+
+  http.useHTTP10(true);
+  http.begin(url);
+  http.setTimeout(10000);
+  http.addHeader("Accept", ImageDecoder::ACCEPT_HEADER);
+  http.addHeader("X-Display-Width", String(targetWidth));
+  http.addHeader("X-Display-Height", String(targetHeight));
+
+  const char* headerKeys[] = {"Content-Type"};
+  http.collectHeaders(headerKeys, 1);
+
+  int httpCode = http.GET();
+  if (httpCode != HTTP_CODE_OK) {
+    Serial.printf("Prefetch request failed with code: %d\n", httpCode);
+    http.end();
+    return false;
+  }
+
+  std::unique_ptr<ImageDecoder> decoder = ImageDecoder::create(http.header("Content-Type"), http.getStream(), display);
+  if (!decoder || !decoder->readHeader()) {
+    http.end();
+    return false;
+  }
+  decoder->setDrawsToDisplay(false);
+
+  ImageCache prefetchCache(ImagePlaylist::PREFETCH_CACHE_PATH, ImagePlaylist::PREFETCH_CACHE_TEMP_PATH);
+  ImageLayout layout = decoder->layoutFor(targetWidth, targetHeight);
+  if (!prefetchCache.beginWrite(cacheKey, layout)) {
+    http.end();
+    return false;
+  }
+
+  bool isComplete = decoder->draw(layout, &prefetchCache);
+  http.end();
+  return prefetchCache.finishWrite(isComplete);
+}
+
+bool ImagePrefetch::waitUntilDone() {
+  if (!isDone) {
+    xSemaphoreTake(doneSemaphore, portMAX_DELAY);
+    isDone = true;
+  }
+  return isCached;
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include "DisplayType.h"
+
+class ImagePrefetch {
+ public:
+  ImagePrefetch(DisplayType& display, const String& url, const String& cacheKey, int16_t targetWidth,
+                int16_t targetHeight);
+  ~ImagePrefetch();
+
+  bool waitUntilDone();
+
+ private:
+  DisplayType& display;
+  String url;
+  String cacheKey;
+  int16_t targetWidth;
+  int16_t targetHeight;
+  SemaphoreHandle_t doneSemaphore;
+  bool isDone;
+  bool isCached;
+
+  bool downloadToCache();
+
+  static void prefetchTask(void* parameter);
+};
@@ -2,13 +2,17 @@
 
 #include <WiFi.h>
 
+#include "FrameHistory.h"
+#include "ImageCache.h"
+#include "ImageDecoder.h"
+#include "ImagePlaylist.h"
+#include "ImagePrefetch.h"
 #include "battery.h"
 
 ImageScreen::ImageScreen(DisplayType& display, ApplicationConfig& config)
     : display(display),
       config(config),
-      smallFont(u8g2_font_helvR08_tr),
-      ditheringServiceUrl("https://dither.shvn.dev") {
+      smallFont(u8g2_font_helvR08_tr) {
   gfx.begin(display);
 }
 
@@ -20,19 +24,24 @@ void ImageScreen::storeImageETag(const String& etag) {
 
 String ImageScreen::getStoredImageETag() { return String(storedImageETag); }
 
-int ImageScreen::downloadAndDisplayImage() {
-  HTTPClient http;
+int16_t ImageScreen::panelWidth() const { return max(display.width(), display.height()); }
+
+int16_t ImageScreen::panelHeight() const { return min(display.width(), display.height()); }
 
-  String requestUrl = ditheringServiceUrl + "/process?url=" + urlEncode(String(config.imageUrl)) +
-                      "&width=" + String(display.height()) + "&height=" + String(display.width()) + "&dither=true";
+int ImageScreen::downloadAndDisplayImage(const String& url) {
+  HTTPClient http;
 
-  Serial.println("Requesting image from: " + requestUrl);
+  Serial.println("Requesting image from: " + url);
 
-  http.begin(requestUrl);
+  http.useHTTP10(true);
+  http.begin(url);
   http.setTimeout(10000);
+  http.addHeader("Accept", ImageDecoder::ACCEPT_HEADER);
+  http.addHeader("X-Display-Width", String(panelWidth()));
+  http.addHeader("X-Display-Height", String(panelHeight()));
 
   String storedETag = getStoredImageETag();
-  if (storedETag.length() > 0) {
+  if (imageCache.contains(storedETag)) {
     http.addHeader("If-None-Match", storedETag);
   }
 
@@ -45,6 +54,7 @@ int ImageScreen::downloadAndDisplayImage() {
   if (httpCode == HTTP_CODE_NOT_MODIFIED) {
     Serial.println("Image not modified (304), using cached version");
     http.end();
+    imageETag = storedETag;
     return httpCode;
   }
 
@@ -55,147 +65,122 @@ int ImageScreen::downloadAndDisplayImage() {
     return httpCode;
   }
 
-  // Store new ETag if present
-  String newETag = http.header("ETag");
-  if (newETag.length() > 0) {
-    storeImageETag(newETag);
+  std::unique_ptr<ImageDecoder> decoder = ImageDecoder::create(http.header("Content-Type"), http.getStream(), display);
+  if (!decoder) {
+    http.end();
+    return HTTP_CODE_UNSUPPORTED_MEDIA_TYPE;
   }
 
-  String contentType = http.header("Content-Type");
-  contentType.toLowerCase();
-  if (!contentType.isEmpty() && contentType != "image/bmp") {
-    Serial.println("Unexpected content type: " + contentType);
+  if (!decoder->readHeader()) {
     http.end();
     return -1;
   }
 
-  String payload = http.getString();
+  display.init(115200);
+  display.setRotation(1);
+  display.fillScreen(GxEPD_WHITE);
 
-  if (payload.length() == 0) {
-    Serial.println("Empty payload received");
-    http.end();
-    return -1;
-  }
+  String newETag = http.header("ETag");
+  ImageLayout layout = decoder->layoutFor(display.width(), display.height());
+  bool isCaching = imageCache.beginWrite(newETag, layout);
 
-  const uint8_t* data = (const uint8_t*)payload.c_str();
-  size_t dataSize = payload.length();
-  size_t dataIndex = 0;
+  bool isComplete = decoder->draw(layout, isCaching ? &imageCache : nullptr);
+  http.end();
 
-  if (dataSize < 54) {
-    Serial.printf("Payload too small for BMP header: got %d bytes, expected at least 54\n", dataSize);
-    http.end();
+  bool isCached = isCaching && imageCache.finishWrite(isComplete);
+  storeImageETag(isCached ? newETag : "");
+
+  if (!isComplete) {
     return -1;
   }
 
-  uint8_t bmpHeader[54];
-  memcpy(bmpHeader, data + dataIndex, 54);
-  dataIndex += 54;
+  imageETag = newETag;
 
-  if (bmpHeader[0] != 'B' || bmpHeader[1] != 'M') {
-    Serial.printf("Invalid BMP signature: got 0x%02X 0x%02X, expected 0x42 0x4D ('BM')\n", bmpHeader[0], bmpHeader[1]);
-    http.end();
-    return -1;
-  }
+  return HTTP_CODE_OK;
+}
 
-  uint32_t dataOffset = bmpHeader[10] | (bmpHeader[11] << 8) | (bmpHeader[12] << 16) | (bmpHeader[13] << 24);
-  uint32_t imageWidth = bmpHeader[18] | (bmpHeader[19] << 8) | (bmpHeader[20] << 16) | (bmpHeader[21] << 24);
-  uint32_t imageHeight = bmpHeader[22] | (bmpHeader[23] << 8) | (bmpHeader[24] << 16) | (bmpHeader[25] << 24);
-  uint16_t bitsPerPixel = bmpHeader[28] | (bmpHeader[29] << 8);
-  uint32_t compression = bmpHeader[30] | (bmpHeader[31] << 8) | (bmpHeader[32] << 16) | (bmpHeader[33] << 24);
+void ImageScreen::render() {
+  ImagePlaylist playlist(config.imageUrl);
 
-  if (bitsPerPixel != 8) {
-    Serial.printf("Unsupported bits per pixel: %d (expected 8 for indexed color)\n", bitsPerPixel);
-    http.end();
-    return -1;
+  if (playlist.hasPrefetchedImage()) {
+    displayPrefetchedImage(playlist);
+    return;
   }
 
-  if (compression != 0) {
-    Serial.printf("Unsupported compression: %d (expected 0 for uncompressed)\n", compression);
-    http.end();
-    return -1;
+  if (!playlist.load()) {
+    displayError("Playlist unavailable");
+    return;
   }
 
-  if (dataIndex + 16 > dataSize) {
-    Serial.printf("Not enough data for color palette: need %d bytes, have %d\n", dataIndex + 16, dataSize);
-    http.end();
-    return -1;
+  int statusCode = downloadAndDisplayImage(playlist.currentUrl());
+
+  std::unique_ptr<ImagePrefetch> prefetch;
+  bool isImageAvailable = statusCode == HTTP_CODE_OK || statusCode == HTTP_CODE_NOT_MODIFIED;
+  if (isImageAvailable && playlist.count() > 1) {
+    prefetch.reset(new ImagePrefetch(display, playlist.nextUrl(), playlist.cacheKey(playlist.nextPosition()),
+                                     panelWidth(), panelHeight()));
   }
 
-  uint8_t palette[16];
-  memcpy(palette, data + dataIndex, 16);
-  dataIndex += 16;
+  displayDownloadResult(statusCode);
 
-  if (dataOffset > dataIndex) {
-    uint32_t skipBytes = dataOffset - dataIndex;
-    if (dataIndex + skipBytes > dataSize) {
-      Serial.printf("Data offset beyond payload size: offset %d, payload size %d\n", dataOffset, dataSize);
-      http.end();
-      return -1;
-    }
-    dataIndex += skipBytes;
+  if (prefetch && prefetch->waitUntilDone()) {
+    playlist.recordPrefetched(playlist.nextPosition());
   }
+  playlist.advance();
+}
+
+void ImageScreen::displayPrefetchedImage(ImagePlaylist& playlist) {
+  String cacheKey = playlist.prefetchedCacheKey();
+  ImageCache prefetchCache(ImagePlaylist::PREFETCH_CACHE_PATH, ImagePlaylist::PREFETCH_CACHE_TEMP_PATH);
+  playlist.discardPrefetched();
+
+  Serial.println("Displaying prefetched image without network: " + cacheKey);
 
   display.init(115200);
   display.setRotation(1);
   display.fillScreen(GxEPD_WHITE);
 
-  int offsetX = 0;
-  int offsetY = 0;
-
-  // Row size padded to 4-byte boundary
-  uint32_t rowSize = ((imageWidth * bitsPerPixel + 31) / 32) * 4;
-  uint8_t* rowBuffer = new uint8_t[rowSize];
-
-  // Create buffer for 2-bit grey pixmap (4 pixels per byte)
-  int16_t pixmapWidth = (imageWidth + 3) / 4;  // bytes per row for 2-bit depth
-  size_t pixmapSize = pixmapWidth * imageHeight;
-  uint8_t* greyPixmap = new uint8_t[pixmapSize];
-  memset(greyPixmap, 0, pixmapSize);
-
-  for (int y = imageHeight - 1; y >= 0; y--) {
-    if (dataIndex + rowSize > dataSize) {
-      Serial.printf("Not enough data for image row: need %d bytes, have %d remaining\n", rowSize, dataSize - dataIndex);
-      delete[] rowBuffer;
-      delete[] greyPixmap;
-      http.end();
-      return -1;
-    }
-
-    memcpy(rowBuffer, data + dataIndex, rowSize);
-    dataIndex += rowSize;
-
-    int pixmapRowY = y;
-
-    for (int x = 0; x < imageWidth; x++) {
-      uint8_t pixelIndex = rowBuffer[x];
-
-      // Pack 4 pixels per byte (2 bits each)
-      int byteIndex = pixmapRowY * pixmapWidth + x / 4;
-      int bitShift = 6 - (x % 4) * 2;  // 6, 4, 2, 0 for positions 0, 1, 2, 3
-
-      greyPixmap[byteIndex] |= (pixelIndex << bitShift);
-    }
+  if (!prefetchCache.draw(display, cacheKey)) {
+    displayError("Failed to load image");
+    return;
   }
 
-  delete[] rowBuffer;
+  FrameHistory frameHistory;
+  frameHistory.refreshIfChanged(display, IMAGE_SCREEN, FrameHistory::addToFingerprint(0, cacheKey));
+  display.hibernate();
+  playlist.advance();
+}
 
-  display.drawGreyPixmap(greyPixmap, 2, offsetX, offsetY, imageWidth, imageHeight);
+void ImageScreen::displayDownloadResult(int statusCode) {
+  FrameHistory frameHistory;
+  uint32_t fingerprint = FrameHistory::addToFingerprint(0, imageETag);
 
-  delete[] greyPixmap;
-  http.end();
+  if (statusCode == HTTP_CODE_NOT_MODIFIED) {
+    if (frameHistory.isDisplayed(IMAGE_SCREEN, fingerprint)) {
+      frameHistory.recordSkippedRefresh();
+      return;
+    }
 
-  return HTTP_CODE_OK;
-}
+    display.init(115200);
+    display.setRotation(1);
+    display.fillScreen(GxEPD_WHITE);
 
-void ImageScreen::render() {
-  int statusCode = downloadAndDisplayImage();
+    if (imageCache.draw(display, imageETag)) {
+      frameHistory.refreshIfChanged(display, IMAGE_SCREEN, fingerprint);
+      display.hibernate();
+      return;
+    }
 
-  if (statusCode == HTTP_CODE_NOT_MODIFIED) {
-    return;
+    storeImageETag("");
+    statusCode = -1;
   }
 
   if (statusCode == HTTP_CODE_OK) {
-    display.displayWindow(0, 0, display.width(), display.height());
+    if (imageETag.isEmpty()) {
+      frameHistory.refresh(display);
+    } else {
+      frameHistory.refreshIfChanged(display, IMAGE_SCREEN, fingerprint);
+    }
     display.hibernate();
     return;
   }
@@ -249,24 +234,9 @@ void ImageScreen::displayError(const String& errorMessage) {
   gfx.setCursor(x, y);
   gfx.print(errorMessage);
 
-  display.displayWindow(0, 0, display.width(), display.height());
+  FrameHistory frameHistory;
+  frameHistory.refresh(display);
   display.hibernate();
 }
 
-String ImageScreen::urlEncode(const String& str) {
-  String encoded = "";
-  char c;
-  for (int i = 0; i < str.length(); i++) {
-    c = str.charAt(i);
-    if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
-      encoded += c;
-    } else {
-      encoded += '%';
-      if (c < 16) encoded += '0';
-      encoded += String(c, HEX);
-    }
-  }
-  return encoded;
-}
-
 int ImageScreen::nextRefreshInSeconds() { return 900; }
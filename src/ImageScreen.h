@@ -6,6 +6,8 @@
 
 #include "ApplicationConfig.h"
 #include "DisplayType.h"
+#include "ImageCache.h"
+#include "ImagePlaylist.h"
 #include "Screen.h"
 
 RTC_DATA_ATTR static char storedImageETag[128] = "";
@@ -17,11 +19,15 @@ class ImageScreen : public Screen {
   ApplicationConfig& config;
 
   const uint8_t* smallFont;
-  String ditheringServiceUrl;
-
-  int downloadAndDisplayImage();
+  ImageCache imageCache;
+  String imageETag;
+
+  int16_t panelWidth() const;
+  int16_t panelHeight() const;
+  int downloadAndDisplayImage(const String& url);
+  void displayDownloadResult(int statusCode);
+  void displayPrefetchedImage(ImagePlaylist& playlist);
   void displayError(const String& errorMessage);
-  String urlEncode(const String& str);
   void storeImageETag(const String& etag);
   String getStoredImageETag();
 
@@ -0,0 +1,149 @@
+#include "JpegStreamDecoder.h"
+
+JpegStreamDecoder::JpegStreamDecoder(Stream& stream, DisplayType& display)
+    : ImageDecoder(stream, display),
+      workBuffer(new uint8_t[WORK_BUFFER_SIZE]),
+      imageWidth(0),
+      imageHeight(0),
+      drawLayout(nullptr),
+      drawCache(nullptr),
+      ditherer(nullptr),
+      decodedWidth(0),
+      decodedHeight(0),
+      bandLuminance(nullptr),
+      luminanceRow(nullptr),
+      packedRow(nullptr) {
+  memset(&decoder, 0, sizeof(decoder));
+}
+
+JpegStreamDecoder::~JpegStreamDecoder() { delete[] workBuffer; }
+
+unsigned int JpegStreamDecoder::readInput(JDEC* jdec, uint8_t* buffer, unsigned int length) {
+  JpegStreamDecoder* self = static_cast<JpegStreamDecoder*>(jdec->device);
+  if (buffer == nullptr) {
+    return self->skip(length) ? length : 0;
+  }
+
+  size_t bytesRead = self->stream.readBytes(buffer, length);
+  self->bytesConsumed += bytesRead;
+  return bytesRead;
+}
+
+unsigned int JpegStreamDecoder::writeBlock(JDEC* jdec, void* bitmap, JRECT* rect) {
+  JpegStreamDecoder* self = static_cast<JpegStreamDecoder*>(jdec->device);
+  self->storeBlock(*rect, static_cast<const uint8_t*>(bitmap));
+  return 1;
+}
+
+uint8_t JpegStreamDecoder::decodeScaleFor(uint32_t sourceWidth, uint32_t sourceHeight, int16_t scaledWidth,
+                                          int16_t scaledHeight) {
+  uint8_t scale = 0;
+  while (scale < MAX_DECODE_SCALE && (sourceWidth >> (scale + 1)) >= (uint32_t)scaledWidth &&
+         (sourceHeight >> (scale + 1)) >= (uint32_t)scaledHeight) {
+    scale++;
+  }
+  return scale;
+}
+
+bool JpegStreamDecoder::readHeader() {
+  JRESULT result = jd_prepare(&decoder, readInput, workBuffer, WORK_BUFFER_SIZE, this);
+  if (result != JDR_OK) {
+    Serial.printf("Unsupported JPEG (error %d), only baseline JPEG files can be decoded\n", result);
+    return false;
+  }
+
+  imageWidth = decoder.width;
+  imageHeight = decoder.height;
+  if (imageWidth == 0 || imageWidth > MAX_IMAGE_WIDTH || imageHeight == 0) {
+    Serial.printf("Unsupported image size: %lux%lu\n", (unsigned long)imageWidth, (unsigned long)imageHeight);
+    return false;
+  }
+
+  return true;
+}
+
+ImageLayout JpegStreamDecoder::layoutFor(int16_t targetWidth, int16_t targetHeight) const {
+  ImageLayout layout;
+  fitWithin(imageWidth, imageHeight, targetWidth, targetHeight, layout.width, layout.height);
+  layout.x = (targetWidth - layout.width) / 2;
+  layout.y = (targetHeight - layout.height) / 2;
+  layout.isBottomUp = false;
+  return layout;
+}
+
+void JpegStreamDecoder::storeBlock(const JRECT& rect, const uint8_t* rgbPixels) {
+  uint16_t blockWidth = rect.right - rect.left + 1;
+  for (uint16_t y = rect.top; y <= rect.bottom; y++) {
+    const uint8_t* pixel = rgbPixels + (y - rect.top) * blockWidth * 3;
+    if (y >= decodedHeight) {
+      continue;
+    }
+    uint8_t* bandRow = bandLuminance + (y - rect.top) * decodedWidth;
+    for (uint16_t x = rect.left; x <= rect.right; x++, pixel += 3) {
+      if (x < decodedWidth) {
+        bandRow[x] = luminance(pixel[0], pixel[1], pixel[2]);
+      }
+    }
+  }
+
+  if (rect.right + 1 >= decodedWidth && rect.left < decodedWidth) {
+    emitBand(rect.top, rect.bottom);
+  }
+}
+
+void JpegStreamDecoder::emitBand(uint16_t top, uint16_t bottom) {
+  int16_t scaledWidth = drawLayout->width;
+  int16_t scaledHeight = drawLayout->height;
+  size_t packedRowBytes = (scaledWidth + 3) / 4;
+  uint32_t step = ((uint32_t)decodedWidth << 16) / scaledWidth;
+
+  for (uint16_t decodedY = top; decodedY <= bottom && decodedY < decodedHeight; decodedY++) {
+    int16_t firstScaledY = ((uint32_t)decodedY * scaledHeight + decodedHeight - 1) / decodedHeight;
+    int16_t endScaledY = ((uint32_t)(decodedY + 1) * scaledHeight + decodedHeight - 1) / decodedHeight;
+    if (firstScaledY == endScaledY) {
+      continue;
+    }
+
+    const uint8_t* bandRow = bandLuminance + (decodedY - top) * decodedWidth;
+    uint32_t position = step >> 1;
+    for (int16_t x = 0; x < scaledWidth; x++, position += step) {
+      luminanceRow[x] = bandRow[position >> 16];
+    }
+
+    for (int16_t y = firstScaledY; y < endScaledY; y++) {
+      ditherer->ditherRow(luminanceRow, packedRow);
+      emitRow(*drawLayout, y, packedRow, packedRowBytes, drawCache);
+    }
+  }
+}
+
+bool JpegStreamDecoder::draw(const ImageLayout& layout, ImageCache* cache) {
+  uint8_t scale = decodeScaleFor(imageWidth, imageHeight, layout.width, layout.height);
+  decodedWidth = max<uint32_t>(imageWidth >> scale, 1);
+  decodedHeight = max<uint32_t>(imageHeight >> scale, 1);
+
+  Serial.printf("Decoding %lux%lu JPEG at 1/%d and dithering to %dx%d\n", (unsigned long)imageWidth,
+                (unsigned long)imageHeight, 1 << scale, layout.width, layout.height);
+
+  GreyDitherer bandDitherer(layout.width);
+  drawLayout = &layout;
+  drawCache = cache;
+  ditherer = &bandDitherer;
+  bandLuminance = new uint8_t[(size_t)decodedWidth * MAX_MCU_HEIGHT];
+  luminanceRow = new uint8_t[layout.width];
+  packedRow = new uint8_t[(layout.width + 3) / 4];
+
+  JRESULT result = jd_decomp(&decoder, writeBlock, scale);
+  if (result != JDR_OK) {
+    Serial.printf("JPEG decoding stopped with error %d after %lu bytes\n", result, (unsigned long)bytesConsumed);
+  }
+
+  delete[] bandLuminance;
+  delete[] luminanceRow;
+  delete[] packedRow;
+  bandLuminance = nullptr;
+  luminanceRow = nullptr;
+  packedRow = nullptr;
+  ditherer = nullptr;
+  return result == JDR_OK;
+}
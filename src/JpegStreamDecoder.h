@@ -0,0 +1,48 @@
+#pragma once
+
+#include <rom/tjpgd.h>
+
+#include "GreyDitherer.h"
+#include "ImageDecoder.h"
+
+class JpegStreamDecoder : public ImageDecoder {
+ public:
+  static const size_t WORK_BUFFER_SIZE = 3100;
+  static const uint32_t MAX_IMAGE_WIDTH = 4096;
+  static const uint8_t MAX_MCU_HEIGHT = 16;
+  static const uint8_t MAX_DECODE_SCALE = 3;
+
+  JpegStreamDecoder(Stream& stream, DisplayType& display);
+  ~JpegStreamDecoder() override;
+
+  bool readHeader() override;
+  ImageLayout layoutFor(int16_t targetWidth, int16_t targetHeight) const override;
+  bool draw(const ImageLayout& layout, ImageCache* cache) override;
+
+  uint32_t width() const { return imageWidth; }
+  uint32_t height() const { return imageHeight; }
+
+  static uint8_t decodeScaleFor(uint32_t sourceWidth, uint32_t sourceHeight, int16_t scaledWidth,
+                                int16_t scaledHeight);
+
+ private:
+  JDEC decoder;
+  uint8_t* workBuffer;
+  uint32_t imageWidth;
+  uint32_t imageHeight;
+
+  const ImageLayout* drawLayout;
+  ImageCache* drawCache;
+  GreyDitherer* ditherer;
+  uint16_t decodedWidth;
+  uint16_t decodedHeight;
+  uint8_t* bandLuminance;
+  uint8_t* luminanceRow;
+  uint8_t* packedRow;
+
+  static unsigned int readInput(JDEC* jdec, uint8_t* buffer, unsigned int length);
+  static unsigned int writeBlock(JDEC* jdec, void* bitmap, JRECT* rect);
+
+  void storeBlock(const JRECT& rect, const uint8_t* rgbPixels);
+  void emitBand(uint16_t top, uint16_t bottom);
+};
@@ -1,21 +1,45 @@
 #include "MessageScreen.h"
 
+#include "ApplicationConfig.h"
+#include "FrameHistory.h"
 #include "battery.h"
 
 MessageScreen::MessageScreen(DisplayType& display)
-    : display(display), primaryFont(u8g2_font_helvB12_tf), smallFont(u8g2_font_micro_tr), messageText("") {
+    : display(display),
+      primaryFont(u8g2_font_helvB12_tf),
+      smallFont(u8g2_font_micro_tr),
+      messageText(""),
+      staticLayoutRendered(false) {
   gfx.begin(display);
 }
 
 void MessageScreen::setMessageText(const String& text) { messageText = text; }
 
-void MessageScreen::render() {
-  Serial.println("Displaying AI message screen");
-
+void MessageScreen::renderStaticLayout() {
   display.init(115200);
   display.setRotation(1);
   display.fillScreen(GxEPD_WHITE);
 
+  batteryStatus = getBatteryStatus();
+  gfx.setFontMode(1);
+  gfx.setForegroundColor(GxEPD_BLACK);
+  gfx.setBackgroundColor(GxEPD_WHITE);
+  gfx.setFont(smallFont);
+
+  int batteryWidth = gfx.getUTF8Width(batteryStatus.c_str());
+  gfx.setCursor(display.width() - batteryWidth - 2, display.height() - 1);
+  gfx.print(batteryStatus);
+
+  staticLayoutRendered = true;
+}
+
+void MessageScreen::render() {
+  Serial.println("Displaying AI message screen");
+
+  if (!staticLayoutRendered) {
+    renderStaticLayout();
+  }
+
   gfx.setFontMode(1);
   gfx.setFontDirection(0);
   gfx.setForegroundColor(GxEPD_BLACK);
@@ -106,16 +130,9 @@ void MessageScreen::render() {
     gfx.print(lines[i]);
   }
 
-  // Display battery status in corner
-  String batteryStatus = getBatteryStatus();
-  gfx.setFont(smallFont);
-  gfx.setForegroundColor(GxEPD_BLACK);
-
-  int batteryWidth = gfx.getUTF8Width(batteryStatus.c_str());
-  gfx.setCursor(displayWidth - batteryWidth - 2, displayHeight - 1);
-  gfx.print(batteryStatus);
-
-  display.displayWindow(0, 0, displayWidth, displayHeight);
+  FrameHistory frameHistory;
+  uint32_t fingerprint = FrameHistory::addToFingerprint(FrameHistory::addToFingerprint(0, messageText), batteryStatus);
+  frameHistory.refreshIfChanged(display, MESSAGE_SCREEN, fingerprint);
   display.hibernate();
   Serial.println("Message displayed");
 }
@@ -15,10 +15,14 @@ class MessageScreen : public Screen {
   const uint8_t* primaryFont;
   const uint8_t* smallFont;
 
+  bool staticLayoutRendered;
+  String batteryStatus;
+
  public:
   MessageScreen(DisplayType& display);
 
   void setMessageText(const String& text);
+  void renderStaticLayout() override;
   void render() override;
   int nextRefreshInSeconds() override;
 };
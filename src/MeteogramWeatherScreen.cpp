@@ -1,32 +1,51 @@
 #include "MeteogramWeatherScreen.h"
 
 #include <algorithm>
-#include <vector>
 
+#include "ApplicationConfig.h"
+#include "FrameHistory.h"
 #include "battery.h"
 
+struct MeteogramPanelState {
+  DisplayRect nowLineRect;
+  uint32_t graphFingerprint;
+  uint32_t currentConditionsFingerprint;
+  uint8_t partialRefreshCount;
+};
+
+RTC_DATA_ATTR static MeteogramPanelState meteogramPanelState;
+
+static const uint8_t PARTIAL_REFRESHES_BEFORE_FULL_REFRESH = 8;
+static const int16_t CLOUD_BAR_HEIGHT = 6;
+static const int16_t CLOUD_BAR_SPACING = 2;
+static const int16_t MINIMUM_PLOT_WIDTH = 21;
+static const int16_t MINIMUM_PLOT_HEIGHT = 11;
+static const int16_t DISPLAY_WINDOW_ALIGNMENT_PIXELS = 8;
+
+static bool rectsIntersect(const DisplayRect &a, const DisplayRect &b) {
+  return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
 MeteogramWeatherScreen::MeteogramWeatherScreen(DisplayType &display, const WeatherForecast &forecast)
     : display(display),
       forecast(forecast),
       primaryFont(u8g2_font_helvR14_tf),
       secondaryFont(u8g2_font_helvR10_tf),
       smallFont(u8g2_font_micro_tr),
-      labelFont(u8g2_font_nokiafc22_tn) {
+      labelFont(u8g2_font_nokiafc22_tn),
+      staticLayoutRendered(false),
+      partialRefreshAllowed(false),
+      temperatureBaseline(0),
+      windBaseline(0),
+      axisLabelHeight(0),
+      graphRect({0, 0, 0, 0}),
+      plotRect({0, 0, 0, 0}),
+      cloudBarRect({0, 0, 0, 0}),
+      nowLineRect({0, 0, 0, 0}),
+      currentConditionsRect({0, 0, 0, 0}) {
   gfx.begin(display);
 }
 
-int MeteogramWeatherScreen::parseHHMMtoMinutes(const String &hhmm) {
-  if (hhmm.length() != 5 || hhmm.charAt(2) != ':') {
-    return -1;
-  }
-  int hours = hhmm.substring(0, 2).toInt();
-  int minutes = hhmm.substring(3, 5).toInt();
-  if (hours < 0 || hours > 23 || minutes < 0 || minutes > 59) {
-    return -1;
-  }
-  return hours * 60 + minutes;
-}
-
 void MeteogramWeatherScreen::drawDottedLine(int x0, int y0, int x1, int y1, uint16_t color) {
   int dx = abs(x1 - x0);
   int dy = abs(y1 - y0);
@@ -64,121 +83,261 @@ void MeteogramWeatherScreen::drawDottedLine(int x0, int y0, int x1, int y1, uint
   }
 }
 
-void MeteogramWeatherScreen::render() {
-  Serial.println("Displaying meteogram screen");
+void MeteogramWeatherScreen::renderStaticLayout() {
+  FrameHistory frameHistory;
+  partialRefreshAllowed = frameHistory.isDisplaying(METEOGRAM_SCREEN) &&
+                          meteogramPanelState.partialRefreshCount < PARTIAL_REFRESHES_BEFORE_FULL_REFRESH;
 
-  display.init(115200);
+  display.init(115200, !partialRefreshAllowed);
   display.setRotation(1);
   display.fillScreen(GxEPD_WHITE);
 
-  String batteryStatus = getBatteryStatus();
-  String windDisplay = String(forecast.currentWindSpeed, 1) + " - " + String(forecast.currentWindGusts, 1) + " m/s";
-
+  batteryStatus = getBatteryStatus();
   gfx.setFontMode(1);
   gfx.setFontDirection(0);
   gfx.setForegroundColor(GxEPD_BLACK);
   gfx.setBackgroundColor(GxEPD_WHITE);
+  gfx.setFont(smallFont);
+  int battery_width = gfx.getUTF8Width(batteryStatus.c_str());
+  gfx.setCursor(display.width() - battery_width - 2, display.height() - 1);
+  gfx.print(batteryStatus);
+
+  layoutGraph();
+  if (hasRoomForGraph()) {
+    display.drawRect(cloudBarRect.x, cloudBarRect.y, cloudBarRect.w, cloudBarRect.h, GxEPD_BLACK);
+    display.drawRect(plotRect.x, plotRect.y, plotRect.w, plotRect.h, GxEPD_BLACK);
+  }
+
+  staticLayoutRendered = true;
+}
+
+void MeteogramWeatherScreen::layoutGraph() {
   gfx.setFont(secondaryFont);
+  int textHeight = gfx.getFontAscent() - gfx.getFontDescent();
+  windBaseline = display.height() - 3;
+  temperatureBaseline = windBaseline - textHeight - 8;
+
+  int16_t graphTop = 2;
+  graphRect = {0, graphTop, (int16_t)display.width(), (int16_t)(temperatureBaseline - graphTop - 15)};
+
+  gfx.setFont(labelFont);
+  int16_t axisLabelWidth = gfx.getUTF8Width("99");
+  axisLabelHeight = gfx.getFontAscent() - gfx.getFontDescent();
+
+  int16_t sidePadding = axisLabelWidth + 6;
+  int16_t bottomPadding = axisLabelHeight + 6;
+  plotRect = {(int16_t)(graphRect.x + sidePadding), (int16_t)(graphRect.y + CLOUD_BAR_HEIGHT + CLOUD_BAR_SPACING),
+              (int16_t)(graphRect.w - 2 * sidePadding),
+              (int16_t)(graphRect.h - bottomPadding - CLOUD_BAR_HEIGHT - CLOUD_BAR_SPACING)};
+  cloudBarRect = {plotRect.x, graphRect.y, plotRect.w, CLOUD_BAR_HEIGHT};
+}
+
+bool MeteogramWeatherScreen::hasRoomForGraph() const {
+  return plotRect.w >= MINIMUM_PLOT_WIDTH && plotRect.h >= MINIMUM_PLOT_HEIGHT;
+}
+
+uint32_t MeteogramWeatherScreen::graphFingerprint() const {
+  uint32_t fingerprint = 0;
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.hourlyStartLocalTime,
+                                               sizeof(forecast.hourlyStartLocalTime));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.hourlyPointCount,
+                                               sizeof(forecast.hourlyPointCount));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, forecast.hourlyTemperatureTenthsCelsius,
+                                               sizeof(forecast.hourlyTemperatureTenthsCelsius));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, forecast.hourlyWindSpeedTenthsMps,
+                                               sizeof(forecast.hourlyWindSpeedTenthsMps));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, forecast.hourlyWindGustsTenthsMps,
+                                               sizeof(forecast.hourlyWindGustsTenthsMps));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, forecast.hourlyPrecipitationTenthsMm,
+                                               sizeof(forecast.hourlyPrecipitationTenthsMm));
+  return FrameHistory::addToFingerprint(fingerprint, forecast.hourlyCloudCoveragePercent,
+                                        sizeof(forecast.hourlyCloudCoveragePercent));
+}
+
+uint32_t MeteogramWeatherScreen::currentConditionsFingerprint() const {
+  uint32_t fingerprint = 0;
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.currentWeatherCode,
+                                               sizeof(forecast.currentWeatherCode));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.currentTemperatureTenthsCelsius,
+                                               sizeof(forecast.currentTemperatureTenthsCelsius));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.currentWindSpeedTenthsMps,
+                                               sizeof(forecast.currentWindSpeedTenthsMps));
+  fingerprint = FrameHistory::addToFingerprint(fingerprint, &forecast.currentWindGustsTenthsMps,
+                                               sizeof(forecast.currentWindGustsTenthsMps));
+  return FrameHistory::addToFingerprint(fingerprint, batteryStatus);
+}
+
+uint32_t MeteogramWeatherScreen::frameFingerprint() const {
+  uint32_t fingerprints[] = {graphFingerprint(), currentConditionsFingerprint()};
+  uint32_t fingerprint = FrameHistory::addToFingerprint(0, fingerprints, sizeof(fingerprints));
+  return FrameHistory::addToFingerprint(fingerprint, &nowLineRect, sizeof(nowLineRect));
+}
+
+void MeteogramWeatherScreen::refreshDisplay() {
+  FrameHistory frameHistory;
+  uint32_t fingerprint = frameFingerprint();
+  uint32_t conditionsFingerprint = currentConditionsFingerprint();
+
+  if (frameHistory.isDisplayed(METEOGRAM_SCREEN, fingerprint)) {
+    frameHistory.recordSkippedRefresh();
+  } else if (partialRefreshAllowed && meteogramPanelState.graphFingerprint == graphFingerprint() &&
+             refreshChangedRegions(conditionsFingerprint)) {
+    meteogramPanelState.partialRefreshCount++;
+  } else {
+    display.display(false);
+    meteogramPanelState.partialRefreshCount = 0;
+  }
+
+  frameHistory.recordDisplayed(METEOGRAM_SCREEN, fingerprint);
+  meteogramPanelState.nowLineRect = nowLineRect;
+  meteogramPanelState.graphFingerprint = graphFingerprint();
+  meteogramPanelState.currentConditionsFingerprint = conditionsFingerprint;
+}
+
+bool MeteogramWeatherScreen::touchesGreyArea(const DisplayRect &window) const {
+  DisplayRect alignedWindow = {(int16_t)(window.x - DISPLAY_WINDOW_ALIGNMENT_PIXELS + 1),
+                               (int16_t)(window.y - DISPLAY_WINDOW_ALIGNMENT_PIXELS + 1),
+                               (int16_t)(window.w + 2 * (DISPLAY_WINDOW_ALIGNMENT_PIXELS - 1)),
+                               (int16_t)(window.h + 2 * (DISPLAY_WINDOW_ALIGNMENT_PIXELS - 1))};
+  for (const DisplayRect &greyArea : greyAreas) {
+    if (rectsIntersect(alignedWindow, greyArea)) {
+      return true;
+    }
+  }
+  return false;
+}
 
-  int text_height = gfx.getFontAscent() - gfx.getFontDescent();
+bool MeteogramWeatherScreen::refreshChangedRegions(uint32_t conditionsFingerprint) {
+  DisplayRect changedWindows[3];
+  int changedWindowCount = 0;
+
+  const DisplayRect &previousRect = meteogramPanelState.nowLineRect;
+  bool nowLineMoved = memcmp(&previousRect, &nowLineRect, sizeof(DisplayRect)) != 0;
+  bool rectsOverlap = previousRect.x < nowLineRect.x + nowLineRect.w && nowLineRect.x < previousRect.x + previousRect.w;
+
+  if (nowLineMoved && rectsOverlap) {
+    int16_t left = std::min(previousRect.x, nowLineRect.x);
+    int16_t right = std::max(previousRect.x + previousRect.w, nowLineRect.x + nowLineRect.w);
+    changedWindows[changedWindowCount++] = {left, nowLineRect.y, (int16_t)(right - left), nowLineRect.h};
+  } else if (nowLineMoved) {
+    if (previousRect.w > 0) {
+      changedWindows[changedWindowCount++] = previousRect;
+    }
+    if (nowLineRect.w > 0) {
+      changedWindows[changedWindowCount++] = nowLineRect;
+    }
+  }
 
-  int wind_y = display.height() - 3;
-  int temp_y = wind_y - text_height - 8;
+  if (meteogramPanelState.currentConditionsFingerprint != conditionsFingerprint) {
+    changedWindows[changedWindowCount++] = currentConditionsRect;
+  }
+
+  for (int i = 0; i < changedWindowCount; i++) {
+    if (touchesGreyArea(changedWindows[i])) {
+      Serial.println("Changed region overlaps grey content, refreshing the full screen");
+      return false;
+    }
+  }
+
+  for (int i = 0; i < changedWindowCount; i++) {
+    display.displayWindow(changedWindows[i].x, changedWindows[i].y, changedWindows[i].w, changedWindows[i].h);
+  }
+
+  Serial.printf("Partial refresh %d of %d before the next full refresh\n", meteogramPanelState.partialRefreshCount + 1,
+                PARTIAL_REFRESHES_BEFORE_FULL_REFRESH);
+  return true;
+}
 
-  int meteogramX = 0;
-  int meteogramY = 2;
-  int meteogramW = display.width();
-  int meteogramH = temp_y - meteogramY - 15;
-  drawMeteogram(meteogramX, meteogramY, meteogramW, meteogramH);
+void MeteogramWeatherScreen::render() {
+  Serial.println("Displaying meteogram screen");
+
+  if (!staticLayoutRendered) {
+    renderStaticLayout();
+  }
+
+  String windDisplay = String(forecast.currentWindSpeed(), 1) + " - " + String(forecast.currentWindGusts(), 1) + " m/s";
+
+  gfx.setFontMode(1);
+  gfx.setFontDirection(0);
+  gfx.setForegroundColor(GxEPD_BLACK);
+  gfx.setBackgroundColor(GxEPD_WHITE);
+  drawMeteogram();
 
   gfx.setFont(primaryFont);
-  gfx.setCursor(6, temp_y);
+  gfx.setCursor(6, temperatureBaseline);
+  int conditionsTop = temperatureBaseline - gfx.getFontAscent() - 1;
+  currentConditionsRect = {0, (int16_t)conditionsTop, (int16_t)display.width(),
+                           (int16_t)(display.height() - conditionsTop)};
 
-  String temperatureDisplay = String(forecast.currentTemperature, 1) + " °C";
+  String temperatureDisplay = String(forecast.currentTemperature(), 1) + " °C";
   gfx.print(temperatureDisplay);
 
   int temp_width = gfx.getUTF8Width(temperatureDisplay.c_str());
 
   gfx.setFont(secondaryFont);
-  gfx.setCursor(6 + temp_width + 8, temp_y);
-  gfx.print(" " + forecast.currentWeatherDescription);
+  gfx.setCursor(6 + temp_width + 8, temperatureBaseline);
+  gfx.print(" " + String(forecast.currentWeatherDescription()));
 
-  gfx.setCursor(6, wind_y);
+  gfx.setCursor(6, windBaseline);
   gfx.print(windDisplay);
 
-  gfx.setForegroundColor(GxEPD_BLACK);
-  gfx.setFont(smallFont);
-  int battery_width = gfx.getUTF8Width(batteryStatus.c_str());
-  int battery_height = gfx.getFontAscent() - gfx.getFontDescent();
-  gfx.setCursor(display.width() - battery_width - 2, display.height() - 1);
-  gfx.print(batteryStatus);
-
-  display.displayWindow(0, 0, display.width(), display.height());
+  refreshDisplay();
   display.hibernate();
   Serial.println("Display updated");
 }
 
-void MeteogramWeatherScreen::drawMeteogram(int x_base, int y_base, int w, int h) {
+void MeteogramWeatherScreen::drawMeteogram() {
+  int x_base = graphRect.x;
+  int y_base = graphRect.y;
+  int w = graphRect.w;
+  int h = graphRect.h;
+
   gfx.setFont(smallFont);
   gfx.setFontMode(1);
   gfx.setForegroundColor(GxEPD_BLACK);
   gfx.setBackgroundColor(GxEPD_WHITE);
 
-  if (forecast.hourlyTemperatures.empty() || forecast.hourlyWindSpeeds.empty() || forecast.hourlyWindGusts.empty() ||
-      forecast.hourlyTime.empty() || forecast.hourlyPrecipitation.empty() || forecast.hourlyCloudCoverage.empty()) {
-    gfx.setCursor(x_base, y_base + h / 2);
+  if (forecast.hourlyCount() == 0) {
+    gfx.setCursor(plotRect.x + 2, y_base + h / 2);
     gfx.print("No meteogram data.");
     return;
   }
 
-  int num_points = std::min({(int)forecast.hourlyTemperatures.size(), (int)forecast.hourlyWindSpeeds.size(),
-                             (int)forecast.hourlyWindGusts.size(), (int)forecast.hourlyTime.size(),
-                             (int)forecast.hourlyPrecipitation.size(), (int)forecast.hourlyCloudCoverage.size(), 24});
+  int num_points = std::min(forecast.hourlyCount(), 24);
   if (num_points <= 1) {
     gfx.setFont(labelFont);
-    gfx.setCursor(x_base, y_base + h / 2);
+    gfx.setCursor(plotRect.x + 2, y_base + h / 2);
     gfx.print("Not enough data.");
     return;
   }
 
-  float min_temp =
-      *std::min_element(forecast.hourlyTemperatures.begin(), forecast.hourlyTemperatures.begin() + num_points);
-  float max_temp =
-      *std::max_element(forecast.hourlyTemperatures.begin(), forecast.hourlyTemperatures.begin() + num_points);
-
-  std::vector<float> allWindData;
-  allWindData.insert(allWindData.end(), forecast.hourlyWindSpeeds.begin(),
-                     forecast.hourlyWindSpeeds.begin() + num_points);
-  allWindData.insert(allWindData.end(), forecast.hourlyWindGusts.begin(),
-                     forecast.hourlyWindGusts.begin() + num_points);
-  float min_wind = *std::min_element(allWindData.begin(), allWindData.end());
-  float max_wind = *std::max_element(allWindData.begin(), allWindData.end());
-
-  float max_precipitation =
-      *std::max_element(forecast.hourlyPrecipitation.begin(), forecast.hourlyPrecipitation.begin() + num_points);
+  float min_temp = forecast.hourlyTemperature(0);
+  float max_temp = forecast.hourlyTemperature(0);
+  float min_wind = std::min(forecast.hourlyWindSpeed(0), forecast.hourlyWindGusts(0));
+  float max_wind = std::max(forecast.hourlyWindSpeed(0), forecast.hourlyWindGusts(0));
+  float max_precipitation = forecast.hourlyPrecipitation(0);
+
+  for (int i = 1; i < num_points; ++i) {
+    min_temp = std::min(min_temp, forecast.hourlyTemperature(i));
+    max_temp = std::max(max_temp, forecast.hourlyTemperature(i));
+    min_wind = std::min({min_wind, forecast.hourlyWindSpeed(i), forecast.hourlyWindGusts(i)});
+    max_wind = std::max({max_wind, forecast.hourlyWindSpeed(i), forecast.hourlyWindGusts(i)});
+    max_precipitation = std::max(max_precipitation, forecast.hourlyPrecipitation(i));
+  }
 
   if (max_temp == min_temp) max_temp += 1.0f;
   if (max_wind == min_wind) max_wind += 1.0f;
   if (max_precipitation == 0.0f) max_precipitation = 1.0f;
 
-  uint16_t label_w, label_h;
-  gfx.setFont(labelFont);
-  label_w = gfx.getUTF8Width("99");
-  label_h = gfx.getFontAscent() - gfx.getFontDescent();
-
-  int left_padding = label_w + 6;
-  int right_padding = label_w + 6;
-  int bottom_padding = label_h + 6;
-
-  const int cloud_bar_height = 6;
-  const int cloud_bar_spacing = 2;
+  uint16_t label_w;
+  int bottom_padding = axisLabelHeight + 6;
 
-  int plot_x = x_base + left_padding;
-  int plot_y = y_base + cloud_bar_height + cloud_bar_spacing;
-  int plot_w = w - left_padding - right_padding;
-  int plot_h = h - bottom_padding - cloud_bar_height - cloud_bar_spacing;
+  int plot_x = plotRect.x;
+  int plot_y = plotRect.y;
+  int plot_w = plotRect.w;
+  int plot_h = plotRect.h;
 
-  if (plot_w <= 20 || plot_h <= 10) {
+  if (!hasRoomForGraph()) {
     gfx.setFont(labelFont);
     gfx.setCursor(x_base, y_base + h / 2);
     gfx.print("Too small for graph.");
@@ -194,7 +353,7 @@ void MeteogramWeatherScreen::drawMeteogram(int x_base, int y_base, int w, int h)
 
     // Get cloud coverage color based on percentage
     uint16_t cloudColor;
-    float coverage = forecast.hourlyCloudCoverage[i];
+    float coverage = forecast.hourlyCloudCoverage(i);
     if (coverage < 25.0f) {
       cloudColor = GxEPD_WHITE;
     } else if (coverage < 50.0f) {
@@ -205,26 +364,30 @@ void MeteogramWeatherScreen::drawMeteogram(int x_base, int y_base, int w, int h)
       cloudColor = GxEPD_BLACK;
     }
 
-    display.fillRect(x1_pos, y_base, segment_width, cloud_bar_height, cloudColor);
+    int inner_left = std::max(x1_pos, plot_x + 1);
+    int inner_right = std::min(x1_pos + segment_width, plot_x + plot_w - 1);
+    display.fillRect(inner_left, cloudBarRect.y + 1, inner_right - inner_left, cloudBarRect.h - 2, cloudColor);
+    if (cloudColor == GxEPD_LIGHTGREY || cloudColor == GxEPD_DARKGREY) {
+      greyAreas.push_back({(int16_t)inner_left, (int16_t)(cloudBarRect.y + 1), (int16_t)(inner_right - inner_left),
+                           (int16_t)(cloudBarRect.h - 2)});
+    }
   }
 
-  // Draw border around cloud coverage bar
-  display.drawRect(plot_x, y_base, plot_w, cloud_bar_height, GxEPD_BLACK);
-
   for (int i = 0; i < num_points; ++i) {
-    if (forecast.hourlyPrecipitation[i] > 0.0f) {
+    if (forecast.hourlyPrecipitation(i) > 0.0f) {
       int x_center = plot_x + round(i * x_step);
       int bar_width = max(1, (int)(x_step * 0.6f));
-      int bar_height = round((forecast.hourlyPrecipitation[i] / max_precipitation) * plot_h);
+      int bar_height = round((forecast.hourlyPrecipitation(i) / max_precipitation) * plot_h);
 
       int bar_x = x_center - bar_width / 2;
       int bar_y = plot_y + plot_h - bar_height;
 
-      bar_x = constrain(bar_x, plot_x, plot_x + plot_w - bar_width);
-      bar_y = constrain(bar_y, plot_y, plot_y + plot_h);
-      bar_height = constrain(bar_height, 0, plot_y + plot_h - bar_y);
+      bar_x = constrain(bar_x, plot_x + 1, plot_x + plot_w - 1 - bar_width);
+      bar_y = constrain(bar_y, plot_y + 1, plot_y + plot_h - 1);
+      bar_height = constrain(bar_height, 0, plot_y + plot_h - 1 - bar_y);
 
       display.fillRect(bar_x, bar_y, bar_width, bar_height, GxEPD_DARKGREY);
+      greyAreas.push_back({(int16_t)bar_x, (int16_t)bar_y, (int16_t)bar_width, (int16_t)bar_height});
     }
   }
 
@@ -253,17 +416,17 @@ void MeteogramWeatherScreen::drawMeteogram(int x_base, int y_base, int w, int h)
     int x2 = plot_x + round((i + 1) * x_step);
 
     int y1_temp =
-        plot_y + plot_h - round(((forecast.hourlyTemperatures[i] - min_temp) / (max_temp - min_temp)) * plot_h);
+        plot_y + plot_h - round(((forecast.hourlyTemperature(i) - min_temp) / (max_temp - min_temp)) * plot_h);
     int y2_temp =
-        plot_y + plot_h - round(((forecast.hourlyTemperatures[i + 1] - min_temp) / (max_temp - min_temp)) * plot_h);
+        plot_y + plot_h - round(((forecast.hourlyTemperature(i + 1) - min_temp) / (max_temp - min_temp)) * plot_h);
 
-    int y1_wind = plot_y + plot_h - round(((forecast.hourlyWindSpeeds[i] - min_wind) / (max_wind - min_wind)) * plot_h);
+    int y1_wind = plot_y + plot_h - round(((forecast.hourlyWindSpeed(i) - min_wind) / (max_wind - min_wind)) * plot_h);
     int y2_wind =
-        plot_y + plot_h - round(((forecast.hourlyWindSpeeds[i + 1] - min_wind) / (max_wind - min_wind)) * plot_h);
+        plot_y + plot_h - round(((forecast.hourlyWindSpeed(i + 1) - min_wind) / (max_wind - min_wind)) * plot_h);
 
-    int y1_gust = plot_y + plot_h - round(((forecast.hourlyWindGusts[i] - min_wind) / (max_wind - min_wind)) * plot_h);
+    int y1_gust = plot_y + plot_h - round(((forecast.hourlyWindGusts(i) - min_wind) / (max_wind - min_wind)) * plot_h);
     int y2_gust =
-        plot_y + plot_h - round(((forecast.hourlyWindGusts[i + 1] - min_wind) / (max_wind - min_wind)) * plot_h);
+        plot_y + plot_h - round(((forecast.hourlyWindGusts(i + 1) - min_wind) / (max_wind - min_wind)) * plot_h);
 
     display.drawLine(constrain(x1, plot_x, plot_x + plot_w - 1), constrain(y1_temp, plot_y, plot_y + plot_h - 1),
                      constrain(x2, plot_x, plot_x + plot_w - 1), constrain(y2_temp, plot_y, plot_y + plot_h - 1),
@@ -276,41 +439,27 @@ void MeteogramWeatherScreen::drawMeteogram(int x_base, int y_base, int w, int h)
                    GxEPD_BLACK);
   }
 
-  display.drawRect(plot_x, plot_y, plot_w, plot_h, GxEPD_BLACK);
-
-  String lastUpdateStr = forecast.lastUpdateTime;
-  int lastUpdateMinutes = parseHHMMtoMinutes(lastUpdateStr);
+  char lastUpdateStr[6];
+  WeatherForecast::formatTimeOfDay(forecast.currentLocalTime, lastUpdateStr, sizeof(lastUpdateStr));
   int final_line_x = -1;
 
-  if (lastUpdateMinutes != -1 && num_points > 1) {
-    for (int i = 0; i < num_points; ++i) {
-      int currentMinutes = parseHHMMtoMinutes(forecast.hourlyTime[i]);
-      if (currentMinutes == -1) continue;
-
-      if (lastUpdateMinutes == currentMinutes) {
-        final_line_x = plot_x + round(i * x_step);
-        break;
-      }
-
-      if (i < num_points - 1) {
-        int nextMinutes = parseHHMMtoMinutes(forecast.hourlyTime[i + 1]);
-        if (nextMinutes != -1 && lastUpdateMinutes > currentMinutes && lastUpdateMinutes < nextMinutes) {
-          float fraction = (float)(lastUpdateMinutes - currentMinutes) / (nextMinutes - currentMinutes);
-          final_line_x = plot_x + round((i + fraction) * x_step);
-          break;
-        }
-      }
-    }
+  int64_t plotStartTime = forecast.hourlyLocalTime(0);
+  int64_t plotEndTime = forecast.hourlyLocalTime(num_points - 1);
+  if (forecast.isValid() && forecast.currentLocalTime >= plotStartTime && forecast.currentLocalTime <= plotEndTime) {
+    float stepsSinceStart = (float)(forecast.currentLocalTime - plotStartTime) / forecast.hourlyStepSeconds;
+    final_line_x = plot_x + round(stepsSinceStart * x_step);
   }
 
   if (final_line_x != -1 && final_line_x >= plot_x && final_line_x <= plot_x + plot_w) {
     display.drawFastVLine(final_line_x, plot_y, plot_h, GxEPD_BLACK);
 
     gfx.setFont(labelFont);
-    label_w = gfx.getUTF8Width(lastUpdateStr.c_str());
+    label_w = gfx.getUTF8Width(lastUpdateStr);
     int time_x = constrain(final_line_x - label_w / 2, x_base, x_base + w - label_w);
     gfx.setCursor(time_x, plot_y + plot_h + bottom_padding - 4);
     gfx.print(lastUpdateStr);
+
+    nowLineRect = {(int16_t)time_x, (int16_t)plot_y, (int16_t)label_w, (int16_t)(plot_h + bottom_padding)};
   }
 }
 
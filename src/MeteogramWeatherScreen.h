@@ -3,28 +3,59 @@
 
 #include <U8g2_for_Adafruit_GFX.h>
 
+#include <vector>
+
 #include "DisplayType.h"
 #include "OpenMeteoAPI.h"
 #include "Screen.h"
 
+struct DisplayRect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
 class MeteogramWeatherScreen : public Screen {
  private:
   DisplayType& display;
   U8G2_FOR_ADAFRUIT_GFX gfx;
-  WeatherForecast forecast;
+  const WeatherForecast& forecast;
 
   const uint8_t* primaryFont;
   const uint8_t* secondaryFont;
   const uint8_t* smallFont;
   const uint8_t* labelFont;
 
-  int parseHHMMtoMinutes(const String& hhmm);
-  void drawMeteogram(int x, int y, int w, int h);
+  bool staticLayoutRendered;
+  bool partialRefreshAllowed;
+  String batteryStatus;
+  int16_t temperatureBaseline;
+  int16_t windBaseline;
+  int16_t axisLabelHeight;
+  DisplayRect graphRect;
+  DisplayRect plotRect;
+  DisplayRect cloudBarRect;
+  DisplayRect nowLineRect;
+  DisplayRect currentConditionsRect;
+  std::vector<DisplayRect> greyAreas;
+
+  uint32_t graphFingerprint() const;
+  uint32_t currentConditionsFingerprint() const;
+  uint32_t frameFingerprint() const;
+  void refreshDisplay();
+  bool touchesGreyArea(const DisplayRect& window) const;
+  bool refreshChangedRegions(uint32_t conditionsFingerprint);
+
+  void layoutGraph();
+  bool hasRoomForGraph() const;
+  void drawMeteogram();
   void drawDottedLine(int x0, int y0, int x1, int y1, uint16_t color);
 
  public:
   MeteogramWeatherScreen(DisplayType& display, const WeatherForecast& forecast);
 
+  void renderStaticLayout() override;
   void render() override;
   int nextRefreshInSeconds() override;
 };
@@ -4,7 +4,7 @@
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
 
-#include <vector>
+#include "WeatherForecast.h"
 
 struct GeocodingResult {
   String name;
@@ -14,27 +14,6 @@ struct GeocodingResult {
   String countryCode;
 };
 
-struct WeatherForecast {
-  String lastUpdateTime;
-
-  float currentTemperature;
-  float currentWindSpeed;
-  float currentWindGusts;
-  int currentWindDirection;
-  String currentWeatherDescription;
-  int currentWeatherCode;
-  String currentWeatherCodeDescription;
-
-  std::vector<float> hourlyTemperatures;
-  std::vector<float> hourlyWindSpeeds;
-  std::vector<float> hourlyWindGusts;
-  std::vector<String> hourlyTime;
-  std::vector<float> hourlyPrecipitation;
-  std::vector<float> hourlyCloudCoverage;
-
-  String apiPayload;
-};
-
 class OpenMeteoAPI {
  public:
   OpenMeteoAPI();
@@ -46,6 +25,4 @@ class OpenMeteoAPI {
   // API settings
   const char* forecastEndpoint = "https://api.open-meteo.com/v1/forecast";
   const char* geocodingEndpoint = "https://geocoding-api.open-meteo.com/v1/search";
-
-  String getWeatherDescription(int weatherCode) const;
 };
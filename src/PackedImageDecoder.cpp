@@ -0,0 +1,108 @@
+#include "PackedImageDecoder.h"
+
+const char* PackedImageDecoder::CONTENT_TYPE = "application/x-grey2";
+
+PackedImageDecoder::PackedImageDecoder(Stream& stream, DisplayType& display)
+    : ImageDecoder(stream, display),
+      imageWidth(0),
+      imageHeight(0),
+      encoding(RAW_ROWS),
+      literalBytesRemaining(0),
+      repeatBytesRemaining(0),
+      repeatedByte(0) {}
+
+bool PackedImageDecoder::readHeader() {
+  uint8_t header[HEADER_SIZE];
+  if (!readFully(header, HEADER_SIZE)) {
+    Serial.printf("Stream too short for packed image header: got %lu bytes, expected %u\n",
+                  (unsigned long)bytesConsumed, (unsigned)HEADER_SIZE);
+    return false;
+  }
+
+  if (memcmp(header, "G2PK", 4) != 0 || header[8] != 1) {
+    Serial.printf("Invalid packed image signature or version: %.4s v%d\n", (const char*)header, header[8]);
+    return false;
+  }
+
+  imageWidth = readUint16(header + 4);
+  imageHeight = readUint16(header + 6);
+  encoding = (Encoding)header[9];
+
+  if (encoding != RAW_ROWS && encoding != PACKBITS_ROWS) {
+    Serial.printf("Unsupported packed image encoding: %d\n", encoding);
+    return false;
+  }
+
+  if (imageWidth == 0 || imageWidth > MAX_IMAGE_WIDTH || imageHeight == 0) {
+    Serial.printf("Unsupported image size: %ux%u\n", imageWidth, imageHeight);
+    return false;
+  }
+
+  return true;
+}
+
+ImageLayout PackedImageDecoder::layoutFor(int16_t targetWidth, int16_t targetHeight) const {
+  ImageLayout layout;
+  layout.width = imageWidth;
+  layout.height = imageHeight;
+  layout.x = max(0, (targetWidth - (int16_t)imageWidth) / 2);
+  layout.y = max(0, (targetHeight - (int16_t)imageHeight) / 2);
+  layout.isBottomUp = false;
+  return layout;
+}
+
+bool PackedImageDecoder::readPackBits(uint8_t* row, size_t length) {
+  size_t filled = 0;
+  while (filled < length) {
+    if (literalBytesRemaining > 0) {
+      size_t chunk = min<size_t>(literalBytesRemaining, length - filled);
+      if (!readFully(row + filled, chunk)) {
+        return false;
+      }
+      literalBytesRemaining -= chunk;
+      filled += chunk;
+    } else if (repeatBytesRemaining > 0) {
+      size_t chunk = min<size_t>(repeatBytesRemaining, length - filled);
+      memset(row + filled, repeatedByte, chunk);
+      repeatBytesRemaining -= chunk;
+      filled += chunk;
+    } else {
+      uint8_t control;
+      if (!readFully(&control, 1)) {
+        return false;
+      }
+      if (control < 128) {
+        literalBytesRemaining = control + 1;
+      } else if (control > 128) {
+        if (!readFully(&repeatedByte, 1)) {
+          return false;
+        }
+        repeatBytesRemaining = 257 - control;
+      }
+    }
+  }
+  return true;
+}
+
+bool PackedImageDecoder::readRow(uint8_t* row, size_t length) {
+  return encoding == PACKBITS_ROWS ? readPackBits(row, length) : readFully(row, length);
+}
+
+bool PackedImageDecoder::draw(const ImageLayout& layout, ImageCache* cache) {
+  size_t rowBytes = (imageWidth + 3) / 4;
+  uint8_t* packedRow = new uint8_t[rowBytes];
+
+  bool isComplete = true;
+  for (uint16_t y = 0; y < imageHeight; y++) {
+    if (!readRow(packedRow, rowBytes)) {
+      Serial.printf("Stream ended at image row %u of %u\n", y, imageHeight);
+      isComplete = false;
+      break;
+    }
+
+    emitRow(layout, y, packedRow, rowBytes, cache);
+  }
+
+  delete[] packedRow;
+  return isComplete;
+}
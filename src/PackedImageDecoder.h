@@ -0,0 +1,32 @@
+#pragma once
+
+#include "ImageDecoder.h"
+
+class PackedImageDecoder : public ImageDecoder {
+ public:
+  static const size_t HEADER_SIZE = 12;
+  static const uint16_t MAX_IMAGE_WIDTH = 1024;
+  static const char* CONTENT_TYPE;
+
+  enum Encoding : uint8_t {
+    RAW_ROWS = 0,
+    PACKBITS_ROWS = 1,
+  };
+
+  PackedImageDecoder(Stream& stream, DisplayType& display);
+
+  bool readHeader() override;
+  ImageLayout layoutFor(int16_t targetWidth, int16_t targetHeight) const override;
+  bool draw(const ImageLayout& layout, ImageCache* cache) override;
+
+ private:
+  uint16_t imageWidth;
+  uint16_t imageHeight;
+  Encoding encoding;
+  uint8_t literalBytesRemaining;
+  uint8_t repeatBytesRemaining;
+  uint8_t repeatedByte;
+
+  bool readRow(uint8_t* row, size_t length);
+  bool readPackBits(uint8_t* row, size_t length);
+};
@@ -0,0 +1,87 @@
+#include "RefreshPolicy.h"
+
+#include <math.h>
+
+static const uint32_t SCHEDULE_INTERVALS_SECONDS[] = {300,  450,  600,  900,  1350,  1800,
+                                                      2700, 3600, 5400, 7200, 10800, 14400};
+static const int SCHEDULE_INTERVAL_COUNT = sizeof(SCHEDULE_INTERVALS_SECONDS) / sizeof(SCHEDULE_INTERVALS_SECONDS[0]);
+
+static const float VOLATILE_WEATHER_FACTOR = 0.5f;
+static const float OVERNIGHT_FACTOR = 4.0f;
+static const int OVERNIGHT_START_HOUR = 23;
+static const int OVERNIGHT_END_HOUR = 6;
+
+static const float DRY_PRECIPITATION_MM = 0.1f;
+static const float PRECIPITATION_ONSET_MM = 0.5f;
+static const float TEMPERATURE_SWING_CELSIUS = 4.0f;
+static const float GUST_INCREASE_MPS = 5.0f;
+
+float RefreshPolicy::batteryFactor(float batteryVoltage) {
+  if (batteryVoltage >= 3.9f) return 1.0f;
+  if (batteryVoltage >= 3.7f) return 1.5f;
+  if (batteryVoltage >= 3.5f) return 2.0f;
+  return 4.0f;
+}
+
+bool RefreshPolicy::isOvernight(int localHour) {
+  if (localHour < 0) {
+    return false;
+  }
+  return localHour >= OVERNIGHT_START_HOUR || localHour < OVERNIGHT_END_HOUR;
+}
+
+bool RefreshPolicy::hasVolatileWeatherAhead(const WeatherForecast& forecast) {
+  if (!forecast.isValid() || forecast.hourlyCount() == 0 || forecast.hourlyStepSeconds == 0) {
+    return false;
+  }
+
+  int64_t secondsSinceStart = forecast.currentLocalTime - forecast.hourlyStartLocalTime;
+  int currentIndex = secondsSinceStart < 0 ? 0 : (int)(secondsSinceStart / forecast.hourlyStepSeconds);
+  if (currentIndex >= forecast.hourlyCount()) {
+    return false;
+  }
+
+  int lastIndex = currentIndex + VOLATILITY_LOOKAHEAD_HOURS;
+  if (lastIndex >= forecast.hourlyCount()) {
+    lastIndex = forecast.hourlyCount() - 1;
+  }
+
+  bool isDryNow = forecast.hourlyPrecipitation(currentIndex) < DRY_PRECIPITATION_MM;
+  float currentTemperature = forecast.hourlyTemperature(currentIndex);
+  float currentGusts = forecast.hourlyWindGusts(currentIndex);
+
+  for (int i = currentIndex + 1; i <= lastIndex; i++) {
+    if (isDryNow && forecast.hourlyPrecipitation(i) >= PRECIPITATION_ONSET_MM) {
+      return true;
+    }
+    if (fabsf(forecast.hourlyTemperature(i) - currentTemperature) >= TEMPERATURE_SWING_CELSIUS) {
+      return true;
+    }
+    if (forecast.hourlyWindGusts(i) - currentGusts >= GUST_INCREASE_MPS) {
+      return true;
+    }
+  }
+  return false;
+}
+
+uint32_t RefreshPolicy::snapToScheduleInterval(float intervalSeconds) {
+  uint32_t snappedInterval = SCHEDULE_INTERVALS_SECONDS[0];
+  for (int i = 0; i < SCHEDULE_INTERVAL_COUNT; i++) {
+    if (fabsf(SCHEDULE_INTERVALS_SECONDS[i] - intervalSeconds) <= fabsf(snappedInterval - intervalSeconds)) {
+      snappedInterval = SCHEDULE_INTERVALS_SECONDS[i];
+    }
+  }
+  return snappedInterval;
+}
+
+uint32_t RefreshPolicy::refreshIntervalSeconds(uint32_t baseIntervalSeconds, const RefreshConditions& conditions) {
+  float intervalSeconds = baseIntervalSeconds * batteryFactor(conditions.batteryVoltage);
+
+  if (isOvernight(conditions.localHour)) {
+    intervalSeconds *= OVERNIGHT_FACTOR;
+  } else if (conditions.forecast != nullptr && hasVolatileWeatherAhead(*conditions.forecast)) {
+    intervalSeconds *= VOLATILE_WEATHER_FACTOR;
+  }
+
+  return snapToScheduleInterval(intervalSeconds);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "WeatherForecast.h"
+
+struct RefreshConditions {
+  float batteryVoltage;
+  int localHour;
+  const WeatherForecast* forecast;
+};
+
+class RefreshPolicy {
+ public:
+  static uint32_t refreshIntervalSeconds(uint32_t baseIntervalSeconds, const RefreshConditions& conditions);
+
+  static float batteryFactor(float batteryVoltage);
+  static bool isOvernight(int localHour);
+  static bool hasVolatileWeatherAhead(const WeatherForecast& forecast);
+  static uint32_t snapToScheduleInterval(float intervalSeconds);
+
+  static const int VOLATILITY_LOOKAHEAD_HOURS = 3;
+};
@@ -4,6 +4,7 @@
 class Screen {
  public:
   virtual ~Screen() = default;
+  virtual void renderStaticLayout() {}
   virtual void render() = 0;
   virtual int nextRefreshInSeconds() = 0;
 };
@@ -0,0 +1,107 @@
+#include "SseTokenParser.h"
+
+#include <ArduinoJson.h>
+
+SseTokenParser::SseTokenParser(size_t maxContentLength, bool stopsAfterJsonArray)
+    : maxContentLength(maxContentLength),
+      stopsAfterJsonArray(stopsAfterJsonArray),
+      isDone(false),
+      isContentFull(false),
+      isLineOverflowed(false),
+      jsonArrayDepth(0),
+      isInJsonString(false),
+      isJsonEscape(false),
+      isJsonArrayClosed(false),
+      lineLength(0),
+      contentBuffer(new char[maxContentLength]),
+      contentLength(0) {
+  lineBuffer[0] = '\0';
+  contentBuffer[0] = '\0';
+}
+
+void SseTokenParser::feed(const char* data, size_t length) {
+  for (size_t i = 0; i < length && !isComplete(); i++) {
+    char c = data[i];
+    if (c == '\n') {
+      if (!isLineOverflowed) {
+        lineBuffer[lineLength] = '\0';
+        handleLine();
+      }
+      lineLength = 0;
+      isLineOverflowed = false;
+    } else if (c != '\r') {
+      if (lineLength < MAX_LINE_LENGTH - 1) {
+        lineBuffer[lineLength++] = c;
+      } else {
+        isLineOverflowed = true;
+      }
+    }
+  }
+}
+
+void SseTokenParser::handleLine() {
+  if (strncmp(lineBuffer, "data:", 5) != 0) {
+    return;
+  }
+
+  char* payload = lineBuffer + 5;
+  while (*payload == ' ') {
+    payload++;
+  }
+
+  if (strcmp(payload, "[DONE]") == 0) {
+    isDone = true;
+    return;
+  }
+
+  StaticJsonDocument<128> filter;
+  filter["choices"][0]["delta"]["content"] = true;
+
+  StaticJsonDocument<512> event;
+  DeserializationError error = deserializeJson(event, payload, DeserializationOption::Filter(filter));
+  if (error) {
+    Serial.printf("Skipping unparsable stream event: %s\n", error.c_str());
+    return;
+  }
+
+  const char* delta = event["choices"][0]["delta"]["content"];
+  if (delta) {
+    appendContent(delta);
+  }
+}
+
+void SseTokenParser::appendContent(const char* text) {
+  for (const char* c = text; *c != '\0' && !isComplete(); c++) {
+    if (contentLength >= maxContentLength - 1) {
+      isContentFull = true;
+      return;
+    }
+    contentBuffer[contentLength++] = *c;
+    contentBuffer[contentLength] = '\0';
+
+    if (stopsAfterJsonArray) {
+      trackJsonArray(*c);
+    }
+  }
+}
+
+void SseTokenParser::trackJsonArray(char c) {
+  if (isInJsonString) {
+    if (isJsonEscape) {
+      isJsonEscape = false;
+    } else if (c == '\\') {
+      isJsonEscape = true;
+    } else if (c == '"') {
+      isInJsonString = false;
+    }
+    return;
+  }
+
+  if (c == '"' && jsonArrayDepth > 0) {
+    isInJsonString = true;
+  } else if (c == '[') {
+    jsonArrayDepth++;
+  } else if (c == ']' && jsonArrayDepth > 0 && --jsonArrayDepth == 0) {
+    isJsonArrayClosed = true;
+  }
+}
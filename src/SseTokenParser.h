@@ -0,0 +1,40 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <memory>
+
+class SseTokenParser {
+ public:
+  static const size_t MAX_LINE_LENGTH = 1024;
+  static const size_t DEFAULT_MAX_CONTENT_LENGTH = 1536;
+
+  explicit SseTokenParser(size_t maxContentLength = DEFAULT_MAX_CONTENT_LENGTH, bool stopsAfterJsonArray = false);
+
+  void feed(const char* data, size_t length);
+  bool isComplete() const { return isDone || isJsonArrayClosed || isContentFull; }
+  bool isTruncated() const { return isContentFull; }
+  bool hasContent() const { return contentLength > 0; }
+  const char* content() const { return contentBuffer.get(); }
+
+ private:
+  size_t maxContentLength;
+  bool stopsAfterJsonArray;
+  bool isDone;
+  bool isContentFull;
+  bool isLineOverflowed;
+
+  int jsonArrayDepth;
+  bool isInJsonString;
+  bool isJsonEscape;
+  bool isJsonArrayClosed;
+
+  char lineBuffer[MAX_LINE_LENGTH];
+  size_t lineLength;
+  std::unique_ptr<char[]> contentBuffer;
+  size_t contentLength;
+
+  void handleLine();
+  void appendContent(const char* text);
+  void trackJsonArray(char c);
+};
@@ -0,0 +1,82 @@
+#include "SummaryCache.h"
+
+#include <esp_attr.h>
+
+#include "FrameHistory.h"
+
+RTC_DATA_ATTR static SummaryCacheEntry cachedSummaryEntry;
+
+static const int TEMPERATURE_STEP_TENTHS = 20;
+static const int WIND_STEP_TENTHS = 30;
+static const int PRECIPITATION_STEP_TENTHS = 10;
+static const int CLOUD_COVERAGE_STEP_PERCENT = 25;
+
+static int32_t quantize(int32_t value, int32_t step) {
+  return value >= 0 ? (value + step / 2) / step : -((-value + step / 2) / step);
+}
+
+int SummaryCache::slotIndex(int64_t localTime) { return WeatherForecast::minutesOfDay(localTime) / (60 * SLOT_HOURS); }
+
+int SummaryCache::remainingSlots(int64_t localTime) {
+  return min<int>(SLOTS_PER_DAY - slotIndex(localTime), SummaryCacheEntry::MAX_SUMMARIES);
+}
+
+bool SummaryCache::hasSummaryFor(uint32_t forecastFingerprint, int64_t localTime) const {
+  int summaryIndex = slotIndex(localTime) - cachedSummaryEntry.firstSlot;
+  return cachedSummaryEntry.summaryCount > 0 && cachedSummaryEntry.forecastFingerprint == forecastFingerprint &&
+         cachedSummaryEntry.localDay == localTime / 86400 && summaryIndex >= 0 &&
+         summaryIndex < cachedSummaryEntry.summaryCount;
+}
+
+String SummaryCache::load(int64_t localTime) const {
+  return String(cachedSummaryEntry.summaries[slotIndex(localTime) - cachedSummaryEntry.firstSlot]);
+}
+
+void SummaryCache::store(uint32_t forecastFingerprint, int64_t localTime, const std::vector<String>& summaries) {
+  cachedSummaryEntry.forecastFingerprint = forecastFingerprint;
+  cachedSummaryEntry.localDay = localTime / 86400;
+  cachedSummaryEntry.firstSlot = slotIndex(localTime);
+  cachedSummaryEntry.summaryCount = min<size_t>(summaries.size(), SummaryCacheEntry::MAX_SUMMARIES);
+
+  for (int i = 0; i < cachedSummaryEntry.summaryCount; i++) {
+    char* summary = cachedSummaryEntry.summaries[i];
+    strncpy(summary, summaries[i].c_str(), SummaryCacheEntry::MAX_SUMMARY_LENGTH - 1);
+    summary[SummaryCacheEntry::MAX_SUMMARY_LENGTH - 1] = '\0';
+  }
+}
+
+uint32_t SummaryCache::forecastFingerprint(const WeatherForecast& forecast, const char* promptStyle) {
+  int64_t localDay = forecast.currentLocalTime / 86400;
+
+  int32_t minimumTemperature = INT16_MAX;
+  int32_t maximumTemperature = INT16_MIN;
+  int32_t maximumGusts = 0;
+  int32_t totalPrecipitation = 0;
+  int32_t totalCloudCoverage = 0;
+  int32_t forecastHours = 0;
+
+  for (int i = 0; i < forecast.hourlyCount(); i++) {
+    int64_t hourTime = forecast.hourlyLocalTime(i);
+    if (hourTime / 86400 != localDay) {
+      continue;
+    }
+    minimumTemperature = min<int32_t>(minimumTemperature, forecast.hourlyTemperatureTenthsCelsius[i]);
+    maximumTemperature = max<int32_t>(maximumTemperature, forecast.hourlyTemperatureTenthsCelsius[i]);
+    maximumGusts = max<int32_t>(maximumGusts, forecast.hourlyWindGustsTenthsMps[i]);
+    totalPrecipitation += forecast.hourlyPrecipitationTenthsMm[i];
+    totalCloudCoverage += forecast.hourlyCloudCoveragePercent[i];
+    forecastHours++;
+  }
+
+  int32_t features[] = {
+      (int32_t)localDay,
+      forecastHours > 0 ? quantize(minimumTemperature, TEMPERATURE_STEP_TENTHS) : 0,
+      forecastHours > 0 ? quantize(maximumTemperature, TEMPERATURE_STEP_TENTHS) : 0,
+      quantize(maximumGusts, WIND_STEP_TENTHS),
+      quantize(totalPrecipitation, PRECIPITATION_STEP_TENTHS),
+      forecastHours > 0 ? quantize(totalCloudCoverage / forecastHours, CLOUD_COVERAGE_STEP_PERCENT) : 0,
+  };
+
+  uint32_t fingerprint = FrameHistory::addToFingerprint(0, features, sizeof(features));
+  return FrameHistory::addToFingerprint(fingerprint, String(promptStyle));
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <Arduino.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "WeatherForecast.h"
+
+struct SummaryCacheEntry {
+  static const int MAX_SUMMARIES = 8;
+  static const size_t MAX_SUMMARY_LENGTH = 160;
+
+  uint32_t forecastFingerprint;
+  int32_t localDay;
+  uint8_t firstSlot;
+  uint8_t summaryCount;
+  char summaries[MAX_SUMMARIES][MAX_SUMMARY_LENGTH];
+};
+
+class SummaryCache {
+ public:
+  static const int SLOT_HOURS = 3;
+  static const int SLOTS_PER_DAY = 24 / SLOT_HOURS;
+
+  bool hasSummaryFor(uint32_t forecastFingerprint, int64_t localTime) const;
+  String load(int64_t localTime) const;
+  void store(uint32_t forecastFingerprint, int64_t localTime, const std::vector<String>& summaries);
+
+  static uint32_t forecastFingerprint(const WeatherForecast& forecast, const char* promptStyle);
+  static int slotIndex(int64_t localTime);
+  static int remainingSlots(int64_t localTime);
+};
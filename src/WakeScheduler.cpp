@@ -0,0 +1,103 @@
+#include "WakeScheduler.h"
+
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <sys/time.h>
+#include <time.h>
+
+RTC_DATA_ATTR static WakeSchedulerState wakeSchedulerState;
+
+int64_t WakeScheduler::correctForDrift(int64_t systemTime, int64_t lastSynchronizedUtc,
+                                       int32_t driftPartsPerMillion) {
+  int64_t systemElapsed = systemTime - lastSynchronizedUtc;
+  return lastSynchronizedUtc + systemElapsed * 1000000 / (1000000 + driftPartsPerMillion);
+}
+
+int32_t WakeScheduler::measureDriftPartsPerMillion(int64_t systemElapsedSeconds, int64_t realElapsedSeconds) {
+  int64_t driftPartsPerMillion = (systemElapsedSeconds - realElapsedSeconds) * 1000000 / realElapsedSeconds;
+  if (driftPartsPerMillion > MAXIMUM_DRIFT_PARTS_PER_MILLION) return MAXIMUM_DRIFT_PARTS_PER_MILLION;
+  if (driftPartsPerMillion < -MAXIMUM_DRIFT_PARTS_PER_MILLION) return -MAXIMUM_DRIFT_PARTS_PER_MILLION;
+  return (int32_t)driftPartsPerMillion;
+}
+
+int32_t WakeScheduler::smoothedDriftPartsPerMillion(int32_t previousEstimate, bool hasPreviousEstimate,
+                                                    int32_t measuredDrift) {
+  return hasPreviousEstimate ? (previousEstimate + measuredDrift) / 2 : measuredDrift;
+}
+
+int64_t WakeScheduler::nextAlignedWakeUtc(int64_t nowUtc, int32_t utcOffsetSeconds, uint32_t refreshIntervalSeconds) {
+  int64_t earliestWakeLocal = nowUtc + utcOffsetSeconds + MINIMUM_SLEEP_SECONDS - PROVIDER_PUBLISH_DELAY_SECONDS;
+  int64_t intervalsSinceEpoch = (earliestWakeLocal + refreshIntervalSeconds - 1) / refreshIntervalSeconds;
+  int64_t nextBoundaryLocal = intervalsSinceEpoch * refreshIntervalSeconds + PROVIDER_PUBLISH_DELAY_SECONDS;
+  return nextBoundaryLocal - utcOffsetSeconds;
+}
+
+uint32_t WakeScheduler::sleepSecondsForClockDrift(int64_t realSleepSeconds, int32_t driftPartsPerMillion) {
+  int64_t sleepSeconds = realSleepSeconds * (1000000 + driftPartsPerMillion) / 1000000;
+  return sleepSeconds < MINIMUM_SLEEP_SECONDS ? MINIMUM_SLEEP_SECONDS : (uint32_t)sleepSeconds;
+}
+
+void WakeScheduler::recordClockSynchronization(WakeSchedulerState& state, int64_t systemTimeAtSync,
+                                               int64_t serverTimeUtc, int32_t utcOffsetSeconds) {
+  if (!state.isClockSynchronized) {
+    state.driftReferenceUtc = serverTimeUtc;
+    state.driftReferenceSystemTime = serverTimeUtc;
+  } else if (serverTimeUtc - state.driftReferenceUtc >= MINIMUM_DRIFT_MEASUREMENT_SECONDS) {
+    int32_t measuredDrift = measureDriftPartsPerMillion(systemTimeAtSync - state.driftReferenceSystemTime,
+                                                        serverTimeUtc - state.driftReferenceUtc);
+    state.driftPartsPerMillion =
+        smoothedDriftPartsPerMillion(state.driftPartsPerMillion, state.hasDriftEstimate, measuredDrift);
+    state.hasDriftEstimate = true;
+    state.driftReferenceUtc = serverTimeUtc;
+    state.driftReferenceSystemTime = serverTimeUtc;
+    Serial.printf("RTC drift measured at %ld ppm, using %ld ppm\n", (long)measuredDrift,
+                  (long)state.driftPartsPerMillion);
+  } else {
+    state.driftReferenceSystemTime += serverTimeUtc - systemTimeAtSync;
+  }
+
+  state.lastSynchronizedUtc = serverTimeUtc;
+  state.utcOffsetSeconds = utcOffsetSeconds;
+  state.isClockSynchronized = true;
+}
+
+void WakeScheduler::synchronizeClock(int64_t serverTimeUtc, int32_t utcOffsetSeconds) {
+  if (serverTimeUtc <= 0) {
+    return;
+  }
+
+  if (wakeSchedulerState.plannedWakeUtc != 0) {
+    Serial.printf("Woke %lld s after the planned wake time\n",
+                  (long long)(serverTimeUtc - wakeSchedulerState.plannedWakeUtc));
+  }
+
+  recordClockSynchronization(wakeSchedulerState, time(nullptr), serverTimeUtc, utcOffsetSeconds);
+
+  struct timeval serverTime = {(time_t)serverTimeUtc, 0};
+  settimeofday(&serverTime, nullptr);
+}
+
+int64_t WakeScheduler::currentTimeUtc() const {
+  return correctForDrift(time(nullptr), wakeSchedulerState.lastSynchronizedUtc,
+                         wakeSchedulerState.driftPartsPerMillion);
+}
+
+int WakeScheduler::currentLocalHour() const {
+  if (!wakeSchedulerState.isClockSynchronized) {
+    return -1;
+  }
+  int64_t secondsOfDay = (currentTimeUtc() + wakeSchedulerState.utcOffsetSeconds) % 86400;
+  return (int)(secondsOfDay / 3600);
+}
+
+uint32_t WakeScheduler::secondsUntilNextWake(uint32_t refreshIntervalSeconds) {
+  if (!wakeSchedulerState.isClockSynchronized || refreshIntervalSeconds == 0) {
+    return refreshIntervalSeconds;
+  }
+
+  int64_t nowUtc = currentTimeUtc();
+  int64_t nextWakeUtc = nextAlignedWakeUtc(nowUtc, wakeSchedulerState.utcOffsetSeconds, refreshIntervalSeconds);
+  wakeSchedulerState.plannedWakeUtc = nextWakeUtc;
+
+  return sleepSecondsForClockDrift(nextWakeUtc - nowUtc, wakeSchedulerState.driftPartsPerMillion);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+struct WakeSchedulerState {
+  int64_t lastSynchronizedUtc;
+  int64_t driftReferenceUtc;
+  int64_t driftReferenceSystemTime;
+  int64_t plannedWakeUtc;
+  int32_t utcOffsetSeconds;
+  int32_t driftPartsPerMillion;
+  bool hasDriftEstimate;
+  bool isClockSynchronized;
+};
+
+class WakeScheduler {
+ public:
+  void synchronizeClock(int64_t serverTimeUtc, int32_t utcOffsetSeconds);
+  int64_t currentTimeUtc() const;
+  int currentLocalHour() const;
+  uint32_t secondsUntilNextWake(uint32_t refreshIntervalSeconds);
+
+  static const uint32_t MINIMUM_SLEEP_SECONDS = 60;
+  static const uint32_t PROVIDER_PUBLISH_DELAY_SECONDS = 90;
+  static const int64_t MINIMUM_DRIFT_MEASUREMENT_SECONDS = 3600;
+  static const int32_t MAXIMUM_DRIFT_PARTS_PER_MILLION = 100000;
+
+  static int64_t correctForDrift(int64_t systemTime, int64_t lastSynchronizedUtc, int32_t driftPartsPerMillion);
+  static int32_t measureDriftPartsPerMillion(int64_t systemElapsedSeconds, int64_t realElapsedSeconds);
+  static int32_t smoothedDriftPartsPerMillion(int32_t previousEstimate, bool hasPreviousEstimate,
+                                              int32_t measuredDrift);
+  static void recordClockSynchronization(WakeSchedulerState& state, int64_t systemTimeAtSync, int64_t serverTimeUtc,
+                                         int32_t utcOffsetSeconds);
+  static int64_t nextAlignedWakeUtc(int64_t nowUtc, int32_t utcOffsetSeconds, uint32_t refreshIntervalSeconds);
+  static uint32_t sleepSecondsForClockDrift(int64_t realSleepSeconds, int32_t driftPartsPerMillion);
+};
@@ -0,0 +1,245 @@
+#include "WeatherForecast.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+const char* getWeatherDescription(int weatherCode) {
+  // https://www.nodc.noaa.gov/archive/arc0021/0002199/1.1/data/0-data/HTML/WMO-CODE/WMO4677.HTM
+  switch (weatherCode) {
+    // Clear and cloudy conditions
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return "Clear";
+
+    // Visibility issues
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+      return "Dusty";
+    case 10:
+    case 11:
+    case 12:
+      return "Foggy";
+    case 40:
+    case 41:
+    case 42:
+    case 43:
+    case 44:
+    case 45:
+    case 46:
+    case 47:
+    case 48:
+    case 49:
+      return "Foggy";
+
+    // Distant weather
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+      return "Distant storms";
+    case 17:
+    case 18:
+    case 19:
+      return "Stormy";
+
+    // Past weather (preceding hour)
+    case 20:
+    case 21:
+    case 22:
+    case 23:
+    case 24:
+    case 25:
+    case 26:
+    case 27:
+    case 28:
+    case 29:
+      return "Recently wet";
+
+    // Dust/sand storms and blowing snow
+    case 30:
+    case 31:
+    case 32:
+    case 33:
+    case 34:
+    case 35:
+      return "Dust storm";
+    case 36:
+    case 37:
+    case 38:
+    case 39:
+      return "Blowing snow";
+
+    // Light precipitation
+    case 50:
+    case 51:
+    case 58:
+      return "Light drizzle";
+    case 52:
+    case 53:
+    case 59:
+      return "Drizzle";
+    case 54:
+    case 55:
+      return "Heavy drizzle";
+    case 56:
+    case 57:
+      return "Freezing drizzle";
+
+    case 60:
+    case 61:
+      return "Light rain";
+    case 62:
+    case 63:
+      return "Rain";
+    case 64:
+    case 65:
+      return "Heavy rain";
+    case 66:
+    case 67:
+      return "Freezing rain";
+    case 68:
+    case 69:
+      return "Rain and snow";
+
+    // Snow
+    case 70:
+    case 71:
+      return "Light snow";
+    case 72:
+    case 73:
+      return "Snow";
+    case 74:
+    case 75:
+      return "Heavy snow";
+    case 76:
+    case 77:
+    case 78:
+      return "Snow crystals";
+    case 79:
+      return "Ice pellets";
+
+    // Showers
+    case 80:
+      return "Light showers";
+    case 81:
+    case 82:
+      return "Heavy showers";
+    case 83:
+    case 84:
+      return "Mixed showers";
+    case 85:
+      return "Snow showers";
+    case 86:
+      return "Heavy snow showers";
+    case 87:
+    case 88:
+    case 89:
+    case 90:
+      return "Hail showers";
+
+    // Thunderstorms
+    case 91:
+    case 92:
+    case 93:
+    case 94:
+      return "Recent storms";
+    case 95:
+      return "Thunderstorm";
+    case 96:
+    case 99:
+      return "Thunderstorm with hail";
+    case 97:
+      return "Heavy thunderstorm";
+    case 98:
+      return "Dust thunderstorm";
+
+    default:
+      return "Unknown";
+  }
+}
+
+int16_t WeatherForecast::toSignedTenths(float value) {
+  if (isnan(value)) {
+    return 0;
+  }
+  long tenths = lroundf(value * 10.0f);
+  if (tenths > INT16_MAX) return INT16_MAX;
+  if (tenths < INT16_MIN) return INT16_MIN;
+  return (int16_t)tenths;
+}
+
+uint16_t WeatherForecast::toUnsignedTenths(float value) {
+  if (isnan(value) || value <= 0.0f) {
+    return 0;
+  }
+  long tenths = lroundf(value * 10.0f);
+  if (tenths > UINT16_MAX) return UINT16_MAX;
+  return (uint16_t)tenths;
+}
+
+uint8_t WeatherForecast::toPercent(float value) {
+  if (isnan(value) || value <= 0.0f) {
+    return 0;
+  }
+  if (value >= 100.0f) {
+    return 100;
+  }
+  return (uint8_t)lroundf(value);
+}
+
+static int64_t daysFromCivil(int year, int month, int day) {
+  year -= month <= 2 ? 1 : 0;
+  int era = (year >= 0 ? year : year - 399) / 400;
+  int yearOfEra = year - era * 400;
+  int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  return (int64_t)era * 146097 + dayOfEra - 719468;
+}
+
+int64_t WeatherForecast::parseLocalTime(const char* isoTimestamp) {
+  int year, month, day, hour, minute;
+  if (isoTimestamp == nullptr ||
+      sscanf(isoTimestamp, "%4d-%2d-%2dT%2d:%2d", &year, &month, &day, &hour, &minute) != 5) {
+    return 0;
+  }
+  return daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60;
+}
+
+int64_t WeatherForecast::parseHttpDate(const char* httpDate) {
+  static const char* monthNames[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+                                     "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+  char monthName[4];
+  int year, day, hour, minute, second;
+  if (httpDate == nullptr ||
+      sscanf(httpDate, "%*3s, %2d %3s %4d %2d:%2d:%2d", &day, monthName, &year, &hour, &minute, &second) != 6) {
+    return 0;
+  }
+
+  for (int month = 1; month <= 12; month++) {
+    if (strncmp(monthName, monthNames[month - 1], 3) == 0) {
+      return daysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
+    }
+  }
+  return 0;
+}
+
+int WeatherForecast::minutesOfDay(int64_t localTime) {
+  int64_t secondsOfDay = localTime % 86400;
+  if (secondsOfDay < 0) {
+    secondsOfDay += 86400;
+  }
+  return (int)(secondsOfDay / 60);
+}
+
+void WeatherForecast::formatTimeOfDay(int64_t localTime, char* buffer, size_t bufferSize) {
+  int minutes = minutesOfDay(localTime);
+  snprintf(buffer, bufferSize, "%02d:%02d", minutes / 60, minutes % 60);
+}
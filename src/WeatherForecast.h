@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+const char* getWeatherDescription(int weatherCode);
+
+struct WeatherForecast {
+  static const int MAX_HOURLY_POINTS = 24;
+
+  int64_t fetchedAtUtc;
+  int64_t currentLocalTime;
+  int64_t currentConditionsLocalTime;
+  int64_t hourlyStartLocalTime;
+  int32_t utcOffsetSeconds;
+  uint16_t hourlyStepSeconds;
+  uint8_t hourlyPointCount;
+  uint8_t currentWeatherCode;
+
+  int16_t currentTemperatureTenthsCelsius;
+  uint16_t currentWindSpeedTenthsMps;
+  uint16_t currentWindGustsTenthsMps;
+  uint16_t currentWindDirectionDegrees;
+
+  int16_t hourlyTemperatureTenthsCelsius[MAX_HOURLY_POINTS];
+  uint16_t hourlyWindSpeedTenthsMps[MAX_HOURLY_POINTS];
+  uint16_t hourlyWindGustsTenthsMps[MAX_HOURLY_POINTS];
+  uint16_t hourlyPrecipitationTenthsMm[MAX_HOURLY_POINTS];
+  uint8_t hourlyCloudCoveragePercent[MAX_HOURLY_POINTS];
+
+  bool isValid() const { return currentLocalTime != 0; }
+
+  float currentTemperature() const { return currentTemperatureTenthsCelsius / 10.0f; }
+  float currentWindSpeed() const { return currentWindSpeedTenthsMps / 10.0f; }
+  float currentWindGusts() const { return currentWindGustsTenthsMps / 10.0f; }
+  int currentWindDirection() const { return currentWindDirectionDegrees; }
+  const char* currentWeatherDescription() const { return getWeatherDescription(currentWeatherCode); }
+
+  int hourlyCount() const { return hourlyPointCount; }
+  int64_t hourlyLocalTime(int index) const { return hourlyStartLocalTime + (int64_t)index * hourlyStepSeconds; }
+  float hourlyTemperature(int index) const { return hourlyTemperatureTenthsCelsius[index] / 10.0f; }
+  float hourlyWindSpeed(int index) const { return hourlyWindSpeedTenthsMps[index] / 10.0f; }
+  float hourlyWindGusts(int index) const { return hourlyWindGustsTenthsMps[index] / 10.0f; }
+  float hourlyPrecipitation(int index) const { return hourlyPrecipitationTenthsMm[index] / 10.0f; }
+  float hourlyCloudCoverage(int index) const { return hourlyCloudCoveragePercent[index]; }
+
+  static int16_t toSignedTenths(float value);
+  static uint16_t toUnsignedTenths(float value);
+  static uint8_t toPercent(float value);
+
+  static int64_t parseLocalTime(const char* isoTimestamp);
+  static int64_t parseHttpDate(const char* httpDate);
+  static void formatTimeOfDay(int64_t localTime, char* buffer, size_t bufferSize);
+  static int minutesOfDay(int64_t localTime);
+};
@@ -0,0 +1,172 @@
+#include "WeatherSentenceGenerator.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+static const int TEMPERATURE_TREND_TENTHS = 20;
+static const uint16_t WET_HOUR_TENTHS_MM = 2;
+static const int16_t SNOW_TEMPERATURE_TENTHS = 5;
+static const uint16_t STRONG_GUST_TENTHS_MPS = 150;
+static const uint16_t WINDY_TENTHS_MPS = 80;
+static const uint16_t BREEZY_TENTHS_MPS = 50;
+
+static const char* periodOfDay(int hour) {
+  if (hour >= 5 && hour < 12) {
+    return "This morning";
+  }
+  if (hour >= 12 && hour < 18) {
+    return "This afternoon";
+  }
+  if (hour >= 18 && hour < 22) {
+    return "This evening";
+  }
+  return "Tonight";
+}
+
+static int roundedDegrees(int tenths) { return tenths >= 0 ? (tenths + 5) / 10 : -((-tenths + 5) / 10); }
+
+static int roundedMps(uint16_t tenths) { return (tenths + 5) / 10; }
+
+size_t WeatherSentenceGenerator::generate(const WeatherForecast& forecast, char* buffer, size_t bufferSize) {
+  if (bufferSize == 0) {
+    return 0;
+  }
+
+  size_t length = 0;
+  auto append = [&](int written) {
+    if (written > 0) {
+      length = length + written < bufferSize ? length + written : bufferSize - 1;
+    }
+  };
+
+  buffer[0] = '\0';
+  if (!forecast.isValid()) {
+    append(snprintf(buffer, bufferSize, "No weather data available right now."));
+    return length;
+  }
+
+  int currentHour = -1;
+  int remaining[WeatherForecast::MAX_HOURLY_POINTS];
+  int remainingCount = 0;
+  int64_t localDay = forecast.currentLocalTime / 86400;
+  for (int i = 0; i < forecast.hourlyCount(); i++) {
+    int64_t hourTime = forecast.hourlyLocalTime(i);
+    if (hourTime / 86400 != localDay) {
+      continue;
+    }
+    if (hourTime > forecast.currentLocalTime) {
+      remaining[remainingCount++] = i;
+    } else if (hourTime + forecast.hourlyStepSeconds > forecast.currentLocalTime) {
+      currentHour = i;
+    }
+  }
+
+  char description[32];
+  strncpy(description, forecast.currentWeatherDescription(), sizeof(description) - 1);
+  description[sizeof(description) - 1] = '\0';
+  for (char* c = description; *c; c++) {
+    *c = tolower(*c);
+  }
+
+  int currentTemperature = forecast.currentTemperatureTenthsCelsius;
+  append(snprintf(buffer + length, bufferSize - length, "%s: %d\xC2\xB0" "C",
+                  periodOfDay(WeatherForecast::minutesOfDay(forecast.currentLocalTime) / 60),
+                  roundedDegrees(currentTemperature)));
+  if (strcmp(description, "unknown") != 0) {
+    append(snprintf(buffer + length, bufferSize - length, " and %s", description));
+  }
+
+  if (remainingCount == 0) {
+    append(snprintf(buffer + length, bufferSize - length, "."));
+    return length;
+  }
+
+  int warmest = remaining[0];
+  int coldest = remaining[0];
+  for (int r = 1; r < remainingCount; r++) {
+    int i = remaining[r];
+    if (forecast.hourlyTemperatureTenthsCelsius[i] > forecast.hourlyTemperatureTenthsCelsius[warmest]) {
+      warmest = i;
+    }
+    if (forecast.hourlyTemperatureTenthsCelsius[i] < forecast.hourlyTemperatureTenthsCelsius[coldest]) {
+      coldest = i;
+    }
+  }
+
+  char hourLabel[6];
+  if (forecast.hourlyTemperatureTenthsCelsius[warmest] - currentTemperature >= TEMPERATURE_TREND_TENTHS) {
+    WeatherForecast::formatTimeOfDay(forecast.hourlyLocalTime(warmest), hourLabel, sizeof(hourLabel));
+    append(snprintf(buffer + length, bufferSize - length, ", rising to %d\xC2\xB0" "C by %s.",
+                    roundedDegrees(forecast.hourlyTemperatureTenthsCelsius[warmest]), hourLabel));
+  } else if (currentTemperature - forecast.hourlyTemperatureTenthsCelsius[coldest] >= TEMPERATURE_TREND_TENTHS) {
+    WeatherForecast::formatTimeOfDay(forecast.hourlyLocalTime(coldest), hourLabel, sizeof(hourLabel));
+    append(snprintf(buffer + length, bufferSize - length, ", falling to %d\xC2\xB0" "C by %s.",
+                    roundedDegrees(forecast.hourlyTemperatureTenthsCelsius[coldest]), hourLabel));
+  } else {
+    append(snprintf(buffer + length, bufferSize - length, ", staying steady."));
+  }
+
+  bool isWetNow = currentHour >= 0 && forecast.hourlyPrecipitationTenthsMm[currentHour] >= WET_HOUR_TENTHS_MM;
+  int firstWet = isWetNow ? currentHour : -1;
+  int lastWet = firstWet;
+  int wetTenthsMm = isWetNow ? forecast.hourlyPrecipitationTenthsMm[currentHour] : 0;
+  int previousHour = currentHour;
+  for (int r = 0; r < remainingCount; r++) {
+    int i = remaining[r];
+    bool isWet = forecast.hourlyPrecipitationTenthsMm[i] >= WET_HOUR_TENTHS_MM;
+    if (isWet && (firstWet < 0 || lastWet == previousHour)) {
+      firstWet = firstWet < 0 ? i : firstWet;
+      lastWet = i;
+      wetTenthsMm += forecast.hourlyPrecipitationTenthsMm[i];
+    } else if (firstWet >= 0) {
+      break;
+    }
+    previousHour = i;
+  }
+
+  if (firstWet < 0) {
+    append(snprintf(buffer + length, bufferSize - length, " Dry for the rest of the day"));
+  } else {
+    const char* kind =
+        forecast.hourlyTemperatureTenthsCelsius[firstWet] <= SNOW_TEMPERATURE_TENTHS ? "Snow" : "Rain";
+    char endLabel[6];
+    WeatherForecast::formatTimeOfDay(forecast.hourlyLocalTime(lastWet) + forecast.hourlyStepSeconds, endLabel,
+                                     sizeof(endLabel));
+    if (isWetNow) {
+      append(snprintf(buffer + length, bufferSize - length, " %s until %s", kind, endLabel));
+    } else {
+      WeatherForecast::formatTimeOfDay(forecast.hourlyLocalTime(firstWet), hourLabel, sizeof(hourLabel));
+      append(snprintf(buffer + length, bufferSize - length, " %s likely %s-%s", kind, hourLabel, endLabel));
+    }
+    append(snprintf(buffer + length, bufferSize - length, " (%d.%d mm)", wetTenthsMm / 10, wetTenthsMm % 10));
+  }
+
+  int gustiest = remaining[0];
+  int windiest = remaining[0];
+  for (int r = 1; r < remainingCount; r++) {
+    int i = remaining[r];
+    if (forecast.hourlyWindGustsTenthsMps[i] > forecast.hourlyWindGustsTenthsMps[gustiest]) {
+      gustiest = i;
+    }
+    if (forecast.hourlyWindSpeedTenthsMps[i] > forecast.hourlyWindSpeedTenthsMps[windiest]) {
+      windiest = i;
+    }
+  }
+
+  if (forecast.hourlyWindGustsTenthsMps[gustiest] >= STRONG_GUST_TENTHS_MPS) {
+    WeatherForecast::formatTimeOfDay(forecast.hourlyLocalTime(gustiest), hourLabel, sizeof(hourLabel));
+    append(snprintf(buffer + length, bufferSize - length, ", gusts up to %d m/s around %s.",
+                    roundedMps(forecast.hourlyWindGustsTenthsMps[gustiest]), hourLabel));
+  } else if (forecast.hourlyWindSpeedTenthsMps[windiest] >= WINDY_TENTHS_MPS) {
+    append(snprintf(buffer + length, bufferSize - length, ", windy at up to %d m/s.",
+                    roundedMps(forecast.hourlyWindSpeedTenthsMps[windiest])));
+  } else if (forecast.hourlyWindSpeedTenthsMps[windiest] >= BREEZY_TENTHS_MPS) {
+    append(snprintf(buffer + length, bufferSize - length, ", breezy at up to %d m/s.",
+                    roundedMps(forecast.hourlyWindSpeedTenthsMps[windiest])));
+  } else {
+    append(snprintf(buffer + length, bufferSize - length, " with light winds."));
+  }
+
+  return length;
+}
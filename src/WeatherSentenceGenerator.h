@@ -0,0 +1,12 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "WeatherForecast.h"
+
+class WeatherSentenceGenerator {
+ public:
+  static const size_t MAX_SENTENCE_LENGTH = 192;
+
+  static size_t generate(const WeatherForecast& forecast, char* buffer, size_t bufferSize);
+};
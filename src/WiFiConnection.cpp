@@ -1,28 +1,151 @@
 #include "WiFiConnection.h"
 
 #include <WiFi.h>
+#include <esp_attr.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+
+RTC_DATA_ATTR static WiFiLeaseCache lastWiFiLease;
+
+static const EventBits_t WIFI_ASSOCIATED_BIT = BIT0;
+static const EventBits_t WIFI_GOT_IP_BIT = BIT1;
+static const EventBits_t WIFI_DISCONNECTED_BIT = BIT2;
+
+static const uint32_t CACHED_LEASE_TIMEOUT_MS = 3000;
+static const uint32_t FULL_SCAN_TIMEOUT_MS = 10000;
+
+static EventGroupHandle_t wifiEventGroup = nullptr;
+static volatile uint32_t associatedAtMillis = 0;
+static volatile uint32_t gotIpAtMillis = 0;
+
+static void clearWiFiEventBits() {
+  xEventGroupClearBits(wifiEventGroup, WIFI_ASSOCIATED_BIT | WIFI_GOT_IP_BIT | WIFI_DISCONNECTED_BIT);
+}
+
+static void onWiFiEvent(arduino_event_id_t event) {
+  switch (event) {
+    case ARDUINO_EVENT_WIFI_STA_CONNECTED:
+      associatedAtMillis = millis();
+      xEventGroupSetBits(wifiEventGroup, WIFI_ASSOCIATED_BIT);
+      break;
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+      gotIpAtMillis = millis();
+      xEventGroupSetBits(wifiEventGroup, WIFI_GOT_IP_BIT);
+      break;
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+      xEventGroupSetBits(wifiEventGroup, WIFI_DISCONNECTED_BIT);
+      break;
+    default:
+      break;
+  }
+}
 
 WiFiConnection::WiFiConnection(const char* ssid, const char* password)
     : _ssid(ssid), _password(password), connected(false) {}
 
 void WiFiConnection::connect() {
   Serial.printf("Connecting to WiFi: %s\n", _ssid);
-  WiFi.begin(_ssid, _password);
-  int attempts = 0;
-  while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-    delay(500);
-    Serial.print(".");
-    attempts++;
-  }
-  if (WiFi.status() == WL_CONNECTED) {
-    Serial.println("\nConnected to WiFi");
+
+  if (wifiEventGroup == nullptr) {
+    wifiEventGroup = xEventGroupCreate();
+  }
+  WiFiEventId_t eventHandlerId = WiFi.onEvent(onWiFiEvent);
+
+  WiFi.mode(WIFI_STA);
+
+  uint32_t connectStartedAtMillis = millis();
+  bool usedCachedLease = connectWithCachedLease();
+  if (!usedCachedLease) {
+    connected = connectWithFullScan();
+  } else {
+    connected = true;
+  }
+  uint32_t connectFinishedAtMillis = millis();
+
+  WiFi.removeEvent(eventHandlerId);
+
+  if (connected) {
+    Serial.println("Connected to WiFi");
     Serial.print("IP address: ");
     Serial.println(WiFi.localIP());
-    connected = true;
+    Serial.printf("WiFi connect latency (%s): association %lu ms, IP %lu ms, total %lu ms\n",
+                  usedCachedLease ? "cached lease" : "full scan",
+                  (unsigned long)(associatedAtMillis - connectStartedAtMillis),
+                  (unsigned long)(gotIpAtMillis - associatedAtMillis),
+                  (unsigned long)(connectFinishedAtMillis - connectStartedAtMillis));
+    if (!usedCachedLease) {
+      storeLease();
+    }
   } else {
-    Serial.println("\nFailed to connect to WiFi");
-    connected = false;
+    Serial.printf("Failed to connect to WiFi after %lu ms\n",
+                  (unsigned long)(connectFinishedAtMillis - connectStartedAtMillis));
+    invalidateLease();
+  }
+}
+
+bool WiFiConnection::connectWithCachedLease() {
+  if (!lastWiFiLease.isValid || lastWiFiLease.credentialsHash != credentialsHash()) {
+    return false;
+  }
+
+  Serial.printf("Reconnecting with cached lease on channel %d\n", lastWiFiLease.channel);
+  WiFi.config(IPAddress(lastWiFiLease.localIP), IPAddress(lastWiFiLease.gatewayIP),
+              IPAddress(lastWiFiLease.subnetMask), IPAddress(lastWiFiLease.dnsIP));
+  clearWiFiEventBits();
+  WiFi.begin(_ssid, _password, lastWiFiLease.channel, lastWiFiLease.bssid, true);
+
+  if (waitForConnection(CACHED_LEASE_TIMEOUT_MS, true)) {
+    return true;
+  }
+
+  Serial.println("Cached lease reconnect failed, falling back to full connect");
+  invalidateLease();
+  WiFi.disconnect();
+  WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE, INADDR_NONE);
+  return false;
+}
+
+bool WiFiConnection::connectWithFullScan() {
+  clearWiFiEventBits();
+  WiFi.begin(_ssid, _password);
+  return waitForConnection(FULL_SCAN_TIMEOUT_MS, false);
+}
+
+bool WiFiConnection::waitForConnection(uint32_t timeoutMs, bool abortOnDisconnect) {
+  EventBits_t awaitedBits = abortOnDisconnect ? (WIFI_GOT_IP_BIT | WIFI_DISCONNECTED_BIT) : WIFI_GOT_IP_BIT;
+  EventBits_t bits = xEventGroupWaitBits(wifiEventGroup, awaitedBits, pdFALSE, pdFALSE, pdMS_TO_TICKS(timeoutMs));
+
+  return (bits & WIFI_GOT_IP_BIT) != 0 && WiFi.status() == WL_CONNECTED;
+}
+
+void WiFiConnection::storeLease() {
+  const uint8_t* bssid = WiFi.BSSID();
+  if (bssid == nullptr) {
+    return;
+  }
+
+  lastWiFiLease.credentialsHash = credentialsHash();
+  memcpy(lastWiFiLease.bssid, bssid, sizeof(lastWiFiLease.bssid));
+  lastWiFiLease.channel = WiFi.channel();
+  lastWiFiLease.localIP = (uint32_t)WiFi.localIP();
+  lastWiFiLease.gatewayIP = (uint32_t)WiFi.gatewayIP();
+  lastWiFiLease.subnetMask = (uint32_t)WiFi.subnetMask();
+  lastWiFiLease.dnsIP = (uint32_t)WiFi.dnsIP();
+  lastWiFiLease.isValid = true;
+}
+
+void WiFiConnection::invalidateLease() { lastWiFiLease.isValid = false; }
+
+uint32_t WiFiConnection::credentialsHash() const {
+  uint32_t hash = 2166136261u;
+  for (const char* c = _ssid; *c != '\0'; c++) {
+    hash = (hash ^ (uint8_t)*c) * 16777619u;
+  }
+  hash = (hash ^ 0xFF) * 16777619u;
+  for (const char* c = _password; *c != '\0'; c++) {
+    hash = (hash ^ (uint8_t)*c) * 16777619u;
   }
+  return hash;
 }
 
 void WiFiConnection::reconnect() {
@@ -1,6 +1,19 @@
 #ifndef WIFI_CONNECTION_H
 #define WIFI_CONNECTION_H
 
+#include <stdint.h>
+
+struct WiFiLeaseCache {
+  uint32_t credentialsHash;
+  uint8_t bssid[6];
+  int32_t channel;
+  uint32_t localIP;
+  uint32_t gatewayIP;
+  uint32_t subnetMask;
+  uint32_t dnsIP;
+  bool isValid;
+};
+
 class WiFiConnection {
  public:
   WiFiConnection(const char* ssid, const char* password);
@@ -13,6 +26,13 @@ class WiFiConnection {
   const char* _ssid;
   const char* _password;
   bool connected;
+
+  bool connectWithCachedLease();
+  bool connectWithFullScan();
+  bool waitForConnection(uint32_t timeoutMs, bool abortOnDisconnect);
+  void storeLease();
+  void invalidateLease();
+  uint32_t credentialsHash() const;
 };
 
 #endif
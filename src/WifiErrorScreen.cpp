@@ -1,5 +1,7 @@
 #include "WifiErrorScreen.h"
 
+#include "FrameHistory.h"
+
 WifiErrorScreen::WifiErrorScreen(DisplayType& display) : display(display) { gfx.begin(display); }
 
 void WifiErrorScreen::render() {
@@ -45,7 +47,8 @@ void WifiErrorScreen::render() {
   gfx.setCursor(errorMessageX, errorMessageY);
   gfx.print(errorMessage);
 
-  display.displayWindow(0, 0, display.width(), display.height());
+  FrameHistory frameHistory;
+  frameHistory.refresh(display);
   display.hibernate();
 }
 
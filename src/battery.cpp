@@ -1,11 +1,15 @@
 #include "battery.h"
 
-String getBatteryStatus() {
+float getBatteryVoltage() {
   int rawValue = analogRead(BATTERY_PIN);
   // Convert to voltage (ESP32 ADC is 12-bit, 0-3.3V)
   float voltage = (rawValue * 3.3) / 4095.0;
   // Adjust for voltage divider
-  voltage *= VOLTAGE_DIVIDER_RATIO;
+  return voltage * VOLTAGE_DIVIDER_RATIO;
+}
+
+String getBatteryStatus() {
+  float voltage = getBatteryVoltage();
 
   // LiPo battery specific calculation
   float percentage;
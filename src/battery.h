@@ -8,4 +8,5 @@
 #define BATTERY_MIN_VOLTAGE 3.3
 #define VOLTAGE_DIVIDER_RATIO 2.0 
 
-String getBatteryStatus(); 
\ No newline at end of file
+float getBatteryVoltage();
+String getBatteryStatus(); 
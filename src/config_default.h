@@ -13,5 +13,8 @@ const char DEFAULT_COUNTRY_CODE[] = "DE";
 const float DEFAULT_LATITUDE = 52.520008;
 const float DEFAULT_LONGITUDE = 13.404954;
 const char DEFAULT_IMAGE_URL[] = "";
+const char DEFAULT_LLM_BASE_URL[] = "https://api.openai.com";
+const char DEFAULT_LLM_MODEL[] = "gpt-4.1-mini";
+const uint16_t DEFAULT_LLM_TIMEOUT_SECONDS = 30;
 
 #endif  // CONFIG_DEFAULT_H
\ No newline at end of file
@@ -0,0 +1,420 @@
+// Generated by tools/build_config_page.py from web/config.html, do not edit.
+#pragma once
+
+#include "ConfigPageStream.h"
+
+static const uint8_t CONFIG_PAGE_CHUNK_0[] = {
+    0xec, 0x1a, 0x59, 0x6f, 0xe3, 0xc6, 0xf9, 0xdd, 0xbf, 0x62, 0xaa, 0x85, 0x21, 0x6b, 0x2b, 0x4a,
+    0xbc, 0x75, 0x58, 0x32, 0x8a, 0x64, 0xb3, 0xc0, 0x02, 0x49, 0x53, 0xd4, 0xbb, 0x08, 0x82, 0x20,
+    0x0f, 0x43, 0x72, 0x28, 0x4d, 0x4c, 0x71, 0x58, 0xce, 0xd0, 0xb2, 0x1b, 0xf4, 0xbf, 0xf7, 0x1b,
+    0x52, 0x07, 0x8f, 0x21, 0x29, 0xdb, 0x69, 0xbb, 0x0f, 0xa5, 0x6d, 0x7a, 0xc8, 0xf9, 0x38, 0xf3,
+    0xdd, 0x17, 0xb9, 0xfa, 0xd3, 0x87, 0x1f, 0xbf, 0xfd, 0xfc, 0xf3, 0xdf, 0xbe, 0x43, 0x5b, 0xb1,
+    0x8b, 0xee, 0xae, 0x56, 0xc5, 0x3f, 0xf8, 0x4f, 0x70, 0x70, 0x77, 0x85, 0xe0, 0x58, 0xed, 0x88,
+    0xc0, 0xc8, 0xdf, 0xe2, 0x94, 0x13, 0xb1, 0x1e, 0x7c, 0xf9, 0xfc, 0x51, 0x9b, 0x0f, 0xca, 0x53,
+    0x31, 0xde, 0x91, 0xf5, 0xe0, 0x91, 0x92, 0x7d, 0xc2, 0x52, 0x31, 0x40, 0x3e, 0x8b, 0x05, 0x89,
+    0x01, 0x74, 0x4f, 0x03, 0xb1, 0x5d, 0x07, 0xe4, 0x91, 0xfa, 0x44, 0xcb, 0x2f, 0xc6, 0x88, 0xc6,
+    0x54, 0x50, 0x1c, 0x69, 0xdc, 0xc7, 0x11, 0x59, 0x1b, 0x13, 0x7d, 0x8c, 0x32, 0x4e, 0xd2, 0xfc,
+    0x1a, 0x7b, 0x70, 0x2b, 0x66, 0xc7, 0xc5, 0x05, 0x15, 0x11, 0xb9, 0xfb, 0x89, 0x60, 0xb1, 0x25,
+    0x29, 0xba, 0x17, 0x58, 0x50, 0x16, 0xa3, 0x6f, 0x59, 0x1c, 0xd2, 0x4d, 0x96, 0xe6, 0x57, 0xab,
+    0x69, 0x01, 0x54, 0x3c, 0xc0, 0xc5, 0xf3, 0x71, 0x2c, 0x8f, 0xf7, 0xe8, 0xf7, 0xd3, 0x58, 0x1e,
+    0x1e, 0x7b, 0xd2, 0x38, 0xfd, 0x27, 0x8d, 0x37, 0x4b, 0x18, 0xa7, 0x01, 0xec, 0x0a, 0xb7, 0x6e,
+    0x4f, 0x30, 0xff, 0xba, 0xba, 0x3a, 0x83, 0x06, 0xcf, 0xb5, 0xa7, 0x43, 0xa0, 0x4a, 0x0b, 0xf1,
+    0x8e, 0x46, 0xcf, 0x4b, 0xa4, 0xe1, 0x24, 0x89, 0x88, 0xc6, 0x9f, 0xb9, 0x20, 0xbb, 0x31, 0xfa,
+    0x26, 0xa2, 0xf1, 0xc3, 0x0f, 0xd8, 0xbf, 0xcf, 0xaf, 0x3f, 0x02, 0xe4, 0x18, 0x0d, 0xef, 0xc9,
+    0x86, 0x11, 0xf4, 0xe5, 0xd3, 0x70, 0x8c, 0xfe, 0xce, 0x3c, 0x26, 0xd8, 0x18, 0xfd, 0xf8, 0xf4,
+    0xbc, 0x21, 0xf1, 0x18, 0x7d, 0xf1, 0xb2, 0x58, 0x64, 0x63, 0xc4, 0x71, 0xcc, 0x35, 0xa0, 0x9e,
+    0x86, 0xb7, 0x95, 0xbd, 0x76, 0xf8, 0xa9, 0xe0, 0xd7, 0x12, 0x19, 0xba, 0x7e, 0x5d, 0x9f, 0x4c,
+    0x37, 0x34, 0x5e, 0x22, 0xbd, 0x7a, 0x3b, 0xc1, 0x41, 0x90, 0x93, 0x66, 0xea, 0xc9, 0x53, 0x75,
+    0xca, 0xc3, 0xfe, 0xc3, 0x26, 0x65, 0x59, 0x1c, 0x2c, 0x11, 0x60, 0x4a, 0x70, 0xaa, 0x6d, 0x52,
+    0x1c, 0x50, 0x10, 0xd2, 0x8d, 0x61, 0x39, 0x01, 0xd9, 0x8c, 0xd1, 0xbb, 0xd0, 0x09, 0x67, 0x21,
+    0x46, 0xfa, 0x35, 0x8c, 0x7d, 0xcb, 0x0f, 0x89, 0x99, 0xef, 0x3d, 0xaa, 0x2e, 0xe5, 0xb3, 0x88,
+    0xa5, 0x4b, 0xf4, 0xce, 0xf4, 0x2d, 0xe2, 0xd4, 0x30, 0x90, 0x4b, 0x6b, 0x5b, 0x42, 0x37, 0x5b,
+    0x01, 0x78, 0x4f, 0x9c, 0xdb, 0x26, 0xff, 0x80, 0xfd, 0x04, 0xe6, 0xdc, 0x3a, 0x86, 0x3b, 0x1a,
+    0x9f, 0x9f, 0xd4, 0xf5, 0xc7, 0x6d, 0x75, 0x3a, 0xa0, 0x3c, 0x89, 0x30, 0xf0, 0x3d, 0x8c, 0x48,
+    0xed, 0x49, 0x1c, 0xd1, 0x4d, 0xac, 0x51, 0x60, 0x3b, 0x5f, 0x22, 0x1f, 0x28, 0x22, 0x69, 0x15,
+    0xe0, 0xb7, 0x8c, 0x0b, 0x1a, 0x3e, 0x6b, 0x07, 0xad, 0x6c, 0x02, 0x95, 0xc4, 0x3e, 0x91, 0x40,
+    0x18, 0xc8, 0x48, 0xeb, 0xaa, 0x53, 0xe2, 0x60, 0xba, 0xf1, 0xf0, 0x8d, 0xe9, 0x38, 0x63, 0x74,
+    0x3e, 0xe9, 0x93, 0x85, 0x33, 0x6a, 0x32, 0x3d, 0x48, 0x59, 0xa2, 0x85, 0x34, 0x82, 0xfd, 0x40,
+    0xe5, 0xa2, 0x2c, 0xbd, 0x31, 0x40, 0x38, 0xa3, 0x16, 0xc1, 0x59, 0x4d, 0xc1, 0x15, 0x5a, 0x2a,
+    0x65, 0x95, 0x71, 0x25, 0xdf, 0xd4, 0xba, 0xd0, 0xa1, 0x3b, 0x27, 0xc5, 0xb2, 0x75, 0xc5, 0x76,
+    0x60, 0x20, 0x5b, 0x1c, 0xb0, 0x3d, 0xac, 0x98, 0xeb, 0x11, 0x50, 0x07, 0x27, 0x4d, 0x9e, 0x72,
+    0xb2, 0xc1, 0x5a, 0x0f, 0xbf, 0x13, 0x63, 0x04, 0x67, 0x24, 0xe9, 0x29, 0x4e, 0x4a, 0x20, 0xdd,
+    0x1e, 0xa9, 0x28, 0x02, 0xd4, 0x00, 0x98, 0xb3, 0x88, 0x06, 0x2d, 0xec, 0x34, 0x47, 0x4a, 0x01,
+    0x6d, 0x8d, 0x9a, 0x60, 0xba, 0xf4, 0x51, 0x90, 0x27, 0xa1, 0xe5, 0xfa, 0xa1, 0xd6, 0x8c, 0x13,
+    0xf3, 0x8e, 0xc4, 0xea, 0xad, 0x1a, 0x6b, 0x9a, 0x75, 0x5e, 0xe5, 0x93, 0xfb, 0x83, 0xca, 0xba,
+    0x7a, 0xdd, 0x14, 0x88, 0x10, 0xd2, 0xa9, 0x25, 0xd8, 0xcf, 0x45, 0xab, 0x01, 0x2b, 0x4c, 0x87,
+    0xec, 0xd4, 0x5a, 0x17, 0xb2, 0x74, 0xa7, 0x49, 0xf5, 0x4a, 0x6a, 0xd4, 0x15, 0x18, 0x82, 0x97,
+    0x12, 0x82, 0xed, 0x00, 0x0b, 0x3b, 0x51, 0xbb, 0x2b, 0xf0, 0x9c, 0x24, 0xaa, 0x3d, 0x7b, 0xb2,
+    0x19, 0x2f, 0x62, 0xfe, 0xc3, 0x6d, 0xd7, 0xba, 0xf3, 0x4e, 0xe2, 0x9c, 0x3a, 0x71, 0x47, 0x9e,
+    0x5b, 0x33, 0xdb, 0x70, 0x8c, 0x76, 0x2b, 0xb7, 0xeb, 0xcb, 0xd6, 0xb9, 0xd2, 0xc9, 0x14, 0x96,
+    0x48, 0x07, 0x0f, 0x91, 0x42, 0x45, 0xdc, 0x11, 0x05, 0xd7, 0x9b, 0x99, 0xf3, 0x76, 0xb1, 0x19,
+    0xdd, 0x62, 0xb3, 0xeb, 0x94, 0x1d, 0xf8, 0x12, 0x91, 0x50, 0xce, 0xb6, 0x30, 0x9b, 0xc6, 0x49,
+    0x26, 0x7e, 0x11, 0xcf, 0x09, 0x04, 0x3d, 0xa9, 0x62, 0x83, 0x5f, 0xc7, 0xca, 0xb9, 0x04, 0x73,
+    0xbe, 0x07, 0x75, 0x1f, 0xfc, 0x5a, 0x43, 0xbe, 0xd5, 0x3a, 0x4f, 0x9e, 0xa0, 0x69, 0xe8, 0x47,
+    0xbb, 0x31, 0x4f, 0x76, 0xf3, 0x8e, 0x38, 0x64, 0x46, 0xbc, 0x6e, 0x87, 0xa1, 0xa6, 0xbf, 0xcd,
+    0x0b, 0x57, 0x42, 0x1c, 0x8d, 0x21, 0xea, 0x52, 0xd1, 0x16, 0x49, 0xb4, 0xa3, 0x08, 0xc2, 0xfc,
+    0x50, 0x6b, 0x88, 0x11, 0x9a, 0x0b, 0x6b, 0xd6, 0xee, 0xea, 0x9d, 0x06, 0x7e, 0x20, 0x1b, 0xef,
+    0x81, 0x0a, 0x19, 0x5f, 0x21, 0x4c, 0xe1, 0xd8, 0x07, 0x44, 0x63, 0x16, 0x93, 0x9a, 0xd3, 0xef,
+    0x9c, 0x15, 0x30, 0xc3, 0xa9, 0xd4, 0x9e, 0x25, 0x84, 0x87, 0x48, 0x7a, 0x13, 0x8e, 0x08, 0xe6,
+    0x44, 0x29, 0x4e, 0x4e, 0x22, 0xe2, 0x8b, 0xff, 0x8b, 0xe8, 0x6b, 0x13, 0x51, 0x8e, 0x64, 0x96,
+    0x72, 0x89, 0x65, 0xc2, 0x68, 0xd3, 0x7d, 0x97, 0x08, 0xa5, 0x3b, 0xbc, 0x81, 0x7d, 0xb2, 0x34,
+    0xba, 0x19, 0x04, 0x58, 0xe0, 0x65, 0x7e, 0x63, 0xca, 0x1f, 0x37, 0x7f, 0x7e, 0xda, 0x45, 0xe3,
+    0x6b, 0xcb, 0x87, 0x21, 0x82, 0x61, 0xcc, 0xd7, 0xc3, 0xad, 0x10, 0xc9, 0x72, 0x3a, 0xdd, 0xef,
+    0xf7, 0x93, 0xbd, 0x35, 0x61, 0xe9, 0x66, 0x6a, 0xea, 0xba, 0x2e, 0x81, 0x87, 0x08, 0x62, 0x75,
+    0xb4, 0x1e, 0x4a, 0x7c, 0x87, 0x48, 0x26, 0xb4, 0xdf, 0xb0, 0xa7, 0xf5, 0xb0, 0x88, 0x0f, 0xf0,
+    0x3b, 0xbc, 0xb6, 0x08, 0xac, 0x95, 0x40, 0x42, 0x8a, 0xb8, 0x48, 0xd9, 0x03, 0x59, 0x0f, 0xaf,
+    0x4d, 0xab, 0x70, 0x42, 0xc3, 0xc3, 0x2d, 0x4d, 0xa6, 0x41, 0x3e, 0x4e, 0xd6, 0xc3, 0x1c, 0xb7,
+    0xca, 0xed, 0xdf, 0x80, 0x8e, 0xfa, 0xfd, 0x22, 0x49, 0x1e, 0x42, 0xbe, 0x34, 0x44, 0xc1, 0x7a,
+    0xb8, 0x73, 0xd1, 0x1c, 0xd9, 0xf2, 0x47, 0xb3, 0x87, 0xd3, 0x62, 0x43, 0x89, 0x1b, 0x8c, 0x06,
+    0xa3, 0x56, 0x06, 0x24, 0xec, 0xc8, 0xcd, 0x54, 0x8a, 0x2d, 0xd7, 0x2a, 0x65, 0xcc, 0x2b, 0x3d,
+    0x93, 0x12, 0x90, 0x90, 0x90, 0xd2, 0x39, 0x0c, 0x5b, 0x21, 0xdb, 0x94, 0xf1, 0x60, 0x0c, 0x5a,
+    0x7a, 0x70, 0xa7, 0xf3, 0x8b, 0x3d, 0xe6, 0x32, 0x64, 0x7e, 0xc6, 0xfb, 0xfc, 0x66, 0x1d, 0xaa,
+    0x30, 0xd5, 0xe2, 0x6e, 0x23, 0xb7, 0xcf, 0xad, 0xea, 0x14, 0x9a, 0xbc, 0xb9, 0x19, 0xba, 0x55,
+    0x6c, 0x59, 0x26, 0xa4, 0x0c, 0x54, 0xea, 0x78, 0xa1, 0xcd, 0x54, 0xf3, 0x23, 0xf9, 0x63, 0x1d,
+    0x73, 0x1e, 0x67, 0x31, 0x46, 0x86, 0x05, 0x39, 0x8f, 0x69, 0xbb, 0x45, 0x76, 0x74, 0x29, 0x27,
+    0x96, 0x10, 0xa5, 0x7d, 0xb2, 0x65, 0x11, 0xe0, 0xdf, 0xcb, 0x90, 0x32, 0x70, 0x4b, 0x48, 0x5c,
+    0xf8, 0xd8, 0xc2, 0xa1, 0x3a, 0xa6, 0x7a, 0x22, 0xee, 0x48, 0x6c, 0x5b, 0x4b, 0x03, 0xd7, 0x9d,
+    0x11, 0x72, 0x28, 0x0d, 0x66, 0xae, 0xed, 0xe1, 0xce, 0xd2, 0x40, 0xc5, 0xb9, 0x8a, 0xdb, 0xac,
+    0xe5, 0x31, 0x65, 0xdf, 0xa9, 0x10, 0x4d, 0x9f, 0xbb, 0xec, 0xf4, 0x11, 0x6f, 0xf4, 0xa5, 0xdd,
+    0x49, 0x5e, 0x4f, 0x85, 0xa6, 0x09, 0x96, 0xa8, 0xaa, 0xb1, 0x6e, 0xef, 0x7a, 0xa1, 0x67, 0xec,
+    0x4d, 0xa5, 0xca, 0x9e, 0x5a, 0xe0, 0x44, 0xdb, 0xc2, 0x86, 0x91, 0xdc, 0xf4, 0xa8, 0xe1, 0xf9,
+    0x46, 0x09, 0x4e, 0x41, 0xd2, 0x5d, 0x5a, 0x0e, 0xa2, 0x42, 0x52, 0x66, 0x9a, 0xd1, 0x5a, 0x03,
+    0x48, 0x5f, 0x63, 0xb7, 0x81, 0xe8, 0xee, 0xa8, 0x55, 0x17, 0x97, 0xd8, 0x17, 0xf4, 0x91, 0xd4,
+    0x54, 0x32, 0x47, 0x4c, 0xa6, 0xc4, 0x07, 0x1c, 0x23, 0x2c, 0xc8, 0xcf, 0x37, 0x46, 0xa3, 0x6e,
+    0xaa, 0x55, 0x2b, 0x5d, 0x48, 0x1c, 0x6a, 0x15, 0xa9, 0x7a, 0xaf, 0xc2, 0x13, 0x72, 0x69, 0xd9,
+    0x9b, 0x08, 0x3a, 0x8c, 0xa7, 0x61, 0x77, 0x65, 0xdd, 0x8c, 0x99, 0x2c, 0x44, 0x22, 0xb6, 0x27,
+    0xc1, 0x6d, 0x1b, 0xad, 0x2a, 0xd5, 0x3f, 0x13, 0x58, 0x9d, 0x2d, 0xe3, 0xc7, 0x05, 0x16, 0x0d,
+    0x77, 0xd8, 0x91, 0xa6, 0xbc, 0xa0, 0xea, 0x69, 0x66, 0xf0, 0x7d, 0x25, 0xd5, 0xa9, 0xe8, 0x78,
+    0x85, 0x21, 0x77, 0x17, 0x1d, 0xdd, 0x56, 0xf3, 0xc7, 0x76, 0x01, 0x0a, 0x96, 0x4e, 0x78, 0xe6,
+    0xfb, 0x84, 0xf3, 0xbe, 0x56, 0x80, 0x65, 0x83, 0xeb, 0x5f, 0xcc, 0xc6, 0x68, 0x61, 0xd7, 0x3d,
+    0x7f, 0x25, 0xd1, 0x72, 0x5d, 0xc7, 0xb2, 0x2f, 0xaa, 0x86, 0x6b, 0x2b, 0x5a, 0xa3, 0x4e, 0x34,
+    0x49, 0x9a, 0xb2, 0xfe, 0x7e, 0x85, 0x05, 0x01, 0xca, 0x9d, 0x17, 0x7f, 0xed, 0x48, 0x06, 0xbe,
+    0xe9, 0x9a, 0xee, 0x65, 0x25, 0x7b, 0x75, 0xc5, 0x1e, 0x24, 0x23, 0x86, 0xa5, 0x42, 0xf6, 0xa2,
+    0x69, 0x43, 0xf5, 0x6f, 0x38, 0xb0, 0xa2, 0x61, 0x74, 0xe2, 0xb9, 0x98, 0xcd, 0xf4, 0x0b, 0xf1,
+    0xac, 0x2d, 0xd9, 0x86, 0x28, 0xa6, 0xe0, 0xb0, 0x37, 0x1b, 0xd9, 0xd5, 0x83, 0x24, 0x43, 0x76,
+    0x1a, 0xbb, 0x6b, 0x71, 0xfd, 0x25, 0xb6, 0xa1, 0xde, 0xa8, 0x3b, 0x1c, 0x77, 0x38, 0xe8, 0x8b,
+    0x0a, 0x8d, 0xae, 0x1a, 0xf9, 0xec, 0x1f, 0xe4, 0x22, 0x6d, 0xb5, 0xcc, 0xc9, 0x58, 0xe7, 0xaf,
+    0x0e, 0xba, 0xf6, 0x1b, 0x83, 0x6e, 0xc3, 0x0f, 0xfc, 0xef, 0xe3, 0xe3, 0x7f, 0xb4, 0x19, 0x29,
+    0x8f, 0x0d, 0x4e, 0x14, 0x2c, 0x3f, 0xfb, 0x6d, 0x9c, 0x09, 0x76, 0x81, 0x6a, 0x2d, 0xb7, 0xec,
+    0xb1, 0xd9, 0xc8, 0xac, 0xe6, 0xc9, 0x81, 0x11, 0x38, 0x81, 0x77, 0x59, 0x7b, 0xa7, 0x7d, 0xa3,
+    0x57, 0x87, 0xf1, 0xda, 0x92, 0x7e, 0xde, 0xda, 0x6f, 0xb1, 0xbf, 0x8e, 0xd0, 0xc2, 0xa4, 0x94,
+    0xc5, 0x73, 0xa3, 0x0d, 0x5a, 0xd6, 0x95, 0x03, 0x8c, 0x74, 0x00, 0x1d, 0xcd, 0x80, 0x26, 0x16,
+    0x13, 0xbe, 0x65, 0xfb, 0x17, 0xb4, 0xd6, 0x4e, 0xb8, 0xa8, 0x39, 0xf7, 0x0e, 0xd3, 0xcf, 0x39,
+    0xe3, 0x3e, 0xf9, 0x0d, 0x0a, 0xcb, 0xe8, 0x9e, 0xb8, 0xd7, 0xa6, 0xe0, 0xad, 0x5d, 0xae, 0xb6,
+    0xcd, 0x26, 0x29, 0x03, 0x57, 0xdc, 0xc8, 0x61, 0x4a, 0x62, 0x2a, 0x00, 0x6e, 0x16, 0x3a, 0x64,
+    0xfd, 0x6a, 0x21, 0x4d, 0xdf, 0xa3, 0x1f, 0x98, 0x47, 0xa5, 0x8f, 0x4c, 0x88, 0x4f, 0x43, 0xea,
+    0x23, 0xba, 0x4b, 0x52, 0xd0, 0xb3, 0x1d, 0xe8, 0x31, 0x47, 0xef, 0xa7, 0x27, 0xd0, 0xbf, 0xec,
+    0x48, 0x40, 0x31, 0xba, 0x29, 0x77, 0x9c, 0xe7, 0xb2, 0xf9, 0xdd, 0x50, 0xc8, 0xc6, 0x9b, 0x96,
+    0xaa, 0x83, 0x72, 0xea, 0x86, 0x50, 0xc2, 0xa7, 0xb3, 0x67, 0x5f, 0x7d, 0x29, 0xd2, 0xb7, 0x4c,
+    0xa3, 0xb3, 0x5c, 0xef, 0x00, 0x37, 0xfc, 0xbd, 0x22, 0x28, 0xf4, 0x23, 0xdb, 0xda, 0xea, 0x55,
+    0x85, 0x18, 0xb3, 0x67, 0xb5, 0xae, 0x4e, 0xe4, 0xc5, 0xdd, 0xc8, 0x1e, 0x6e, 0x37, 0x72, 0x2f,
+    0xbd, 0x07, 0x29, 0x65, 0x3f, 0xed, 0xcd, 0x9b, 0xa8, 0xda, 0x0d, 0xbd, 0xcc, 0x6e, 0xc6, 0x57,
+    0x45, 0x2d, 0xaa, 0xbf, 0x86, 0x62, 0xb5, 0x6d, 0x7c, 0x8f, 0xe3, 0x80, 0xfb, 0x38, 0x21, 0x88,
+    0xa5, 0xb2, 0x82, 0x2e, 0x5e, 0x58, 0xe2, 0x40, 0x7a, 0xfd, 0x56, 0x03, 0x29, 0x81, 0x42, 0x09,
+    0x7e, 0x5c, 0x61, 0x84, 0x60, 0x54, 0x58, 0xcf, 0x19, 0x8f, 0xcb, 0xcd, 0xa7, 0x12, 0x88, 0x64,
+    0x9c, 0xd2, 0x20, 0x0f, 0x4b, 0x45, 0x3b, 0x4f, 0xf3, 0x5a, 0xf5, 0x6d, 0xb6, 0x56, 0xae, 0x7a,
+    0xf5, 0x97, 0xdb, 0x5a, 0x6f, 0x7e, 0xf5, 0x16, 0x53, 0x32, 0xe6, 0x97, 0xca, 0xf0, 0x03, 0x4e,
+    0x1f, 0xd0, 0x8e, 0x05, 0x04, 0xf1, 0x2c, 0x91, 0xef, 0xb3, 0x55, 0x32, 0x4b, 0x52, 0x12, 0x92,
+    0x94, 0x17, 0x61, 0x54, 0xe3, 0xfe, 0x16, 0xfc, 0xdf, 0x12, 0x05, 0xf0, 0xe8, 0x85, 0xf2, 0xb9,
+    0xa8, 0xed, 0x62, 0x10, 0x73, 0x61, 0x79, 0x45, 0xdb, 0xc5, 0xb2, 0x20, 0x18, 0x3b, 0xaa, 0xb6,
+    0x4b, 0x39, 0x64, 0x13, 0x93, 0xcc, 0x43, 0xfd, 0xf5, 0x22, 0x6c, 0xd6, 0x36, 0x50, 0x1b, 0xdb,
+    0x90, 0x36, 0xcb, 0xf6, 0x96, 0xe2, 0x1d, 0xe7, 0x4b, 0xde, 0xe8, 0xd5, 0x53, 0xf9, 0x4b, 0x74,
+    0xe2, 0xd4, 0x52, 0x32, 0x42, 0x27, 0x5c, 0x74, 0x3e, 0xaf, 0x7a, 0x4b, 0x54, 0x5e, 0xc2, 0xf7,
+    0x02, 0x87, 0x18, 0xdd, 0xac, 0xe9, 0x7c, 0xe5, 0x54, 0x49, 0xa9, 0xed, 0x99, 0x3d, 0xf7, 0xfe,
+    0x3b, 0xbe, 0xb9, 0xd9, 0x9b, 0x2c, 0x1a, 0x8e, 0x20, 0x15, 0x17, 0x18, 0x3b, 0xcf, 0x99, 0xdb,
+    0x2e, 0x98, 0x53, 0xaa, 0x67, 0xcf, 0x1c, 0xc7, 0x5d, 0xdc, 0xbe, 0x85, 0xc7, 0xad, 0xae, 0xfd,
+    0x2b, 0xc2, 0xb1, 0xbf, 0xd7, 0xdc, 0xd7, 0x6f, 0x56, 0xd1, 0x57, 0x45, 0xd3, 0xd5, 0xb1, 0x13,
+    0xe2, 0xdb, 0xd7, 0xb1, 0x61, 0x36, 0xba, 0x80, 0xc7, 0x5f, 0x03, 0x26, 0x17, 0xf7, 0xaa, 0x5f,
+    0xd7, 0xaf, 0x7e, 0xa1, 0x3d, 0x75, 0x96, 0xcd, 0xaf, 0x50, 0xa5, 0x85, 0x8d, 0x2d, 0x6f, 0xfe,
+    0x82, 0x2d, 0x95, 0xe5, 0x94, 0x4a, 0x24, 0x0a, 0x5a, 0xfa, 0x1d, 0x51, 0x75, 0xb4, 0x9a, 0x1e,
+    0x3e, 0x65, 0x5a, 0x4d, 0x8b, 0xef, 0xb0, 0xae, 0x56, 0x32, 0x90, 0x1c, 0x3e, 0x73, 0x0a, 0xe8,
+    0x23, 0xf2, 0x23, 0x60, 0xf2, 0x7a, 0x70, 0x72, 0xe6, 0x83, 0xf3, 0x67, 0x4f, 0xab, 0xad, 0xd1,
+    0xf8, 0x68, 0xea, 0x9e, 0x88, 0x2c, 0x81, 0xc5, 0x8c, 0xbb, 0x33, 0x89, 0xf9, 0x3a, 0x34, 0x58,
+    0x0f, 0x8a, 0x16, 0xcd, 0xe0, 0xb8, 0xe6, 0xe1, 0xf2, 0x6e, 0x35, 0x05, 0x80, 0x32, 0x7c, 0x5e,
+    0x8e, 0xc8, 0x07, 0x8a, 0x0a, 0xe9, 0x23, 0x5c, 0x96, 0xb6, 0xad, 0xa3, 0x76, 0x0e, 0xcf, 0x35,
+    0xa0, 0x1c, 0xb0, 0xf0, 0xb0, 0x00, 0x03, 0xfb, 0x71, 0x1a, 0x0c, 0xee, 0x7e, 0xa2, 0x1f, 0x29,
+    0xfa, 0x2b, 0x11, 0xa0, 0x38, 0x0f, 0xe8, 0xe6, 0xfe, 0xfe, 0xd3, 0x87, 0xd1, 0x6a, 0x9a, 0x43,
+    0x29, 0x9e, 0xce, 0xb5, 0x0d, 0x95, 0x54, 0xb3, 0xa0, 0x43, 0x2e, 0x74, 0xf8, 0x1a, 0xad, 0x18,
+    0xa7, 0xe4, 0x1f, 0x19, 0x4d, 0xa1, 0xe6, 0x29, 0xa9, 0xe1, 0x7a, 0xf0, 0x9d, 0x2c, 0xb9, 0x51,
+    0x7c, 0xd8, 0x4b, 0xc2, 0x0f, 0x1a, 0x5b, 0xc8, 0xe3, 0x11, 0x47, 0x19, 0x2c, 0xf5, 0x6f, 0x00,
+    0x00, 0x00, 0xff, 0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_1[] = {
+    0x6c, 0x8e, 0xbb, 0x0e, 0xc2, 0x30, 0x0c, 0x45, 0xf7, 0x7e, 0x85, 0x95, 0x1d, 0xf5, 0x07, 0xda,
+    0x6e, 0x30, 0xb3, 0x31, 0x87, 0xc6, 0x05, 0x4b, 0x6e, 0x1c, 0x52, 0xa7, 0x3c, 0xbe, 0x9e, 0xd0,
+    0x56, 0xa8, 0x3c, 0xee, 0xe6, 0xa3, 0xe3, 0x6b, 0x1b, 0xb0, 0x49, 0xa5, 0x95, 0x3e, 0x30, 0x2a,
+    0xd6, 0x46, 0xba, 0xce, 0xcc, 0xc8, 0x06, 0x52, 0xcb, 0xf4, 0xc8, 0xd0, 0x8b, 0xc7, 0x85, 0x4a,
+    0x8c, 0xd8, 0xea, 0xec, 0x35, 0x05, 0xac, 0x52, 0x95, 0x8e, 0xc6, 0xa6, 0xf8, 0x64, 0x19, 0x41,
+    0xcb, 0x76, 0x18, 0x6a, 0xd3, 0x49, 0xec, 0x37, 0xa7, 0x28, 0x29, 0x7c, 0x2d, 0x4e, 0x22, 0xdb,
+    0x23, 0x32, 0x64, 0xa7, 0x36, 0x21, 0xeb, 0x57, 0x89, 0xce, 0x34, 0x07, 0xda, 0x11, 0xec, 0x97,
+    0xb1, 0x2a, 0x27, 0xe7, 0xcf, 0x2e, 0xf9, 0x90, 0x14, 0xf4, 0x1e, 0xf2, 0xab, 0x8a, 0x37, 0x35,
+    0x40, 0x6e, 0x55, 0x03, 0xde, 0xf6, 0xb8, 0x9e, 0x23, 0x5e, 0x12, 0x45, 0x74, 0x10, 0xd8, 0xb6,
+    0x78, 0x16, 0x76, 0x98, 0xcf, 0x6e, 0xbd, 0x62, 0x84, 0xb7, 0xf5, 0x73, 0xe6, 0x95, 0xd1, 0x72,
+    0xca, 0x55, 0x4f, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_2[] = {
+    0x6c, 0x8e, 0xdb, 0x0e, 0x82, 0x30, 0x0c, 0x40, 0xdf, 0xf9, 0x8a, 0x66, 0x4f, 0x9a, 0x28, 0xfc,
+    0x00, 0xf0, 0xa0, 0xf1, 0x43, 0xe6, 0x28, 0xb8, 0xa4, 0xac, 0xcb, 0xe8, 0x88, 0xf8, 0xf5, 0x8e,
+    0x8b, 0x89, 0xb7, 0x3e, 0x34, 0xcd, 0xe9, 0xe9, 0x45, 0x81, 0x8e, 0xc2, 0x86, 0x7b, 0x4f, 0x28,
+    0x58, 0x29, 0x6e, 0x5b, 0xb5, 0x22, 0xed, 0xad, 0x68, 0xb2, 0x8f, 0x04, 0x1d, 0x3b, 0xdc, 0x28,
+    0x87, 0x80, 0x46, 0x56, 0xaf, 0xce, 0xe0, 0x2d, 0xca, 0xa2, 0xb1, 0x63, 0x9d, 0x7d, 0xb2, 0x84,
+    0xc0, 0x90, 0x1e, 0x86, 0x4a, 0xb5, 0x1c, 0xfa, 0x63, 0x17, 0x38, 0xfa, 0xaf, 0xc1, 0x45, 0x24,
+    0x7d, 0x45, 0x82, 0xe4, 0x54, 0xca, 0x58, 0x99, 0x54, 0x7d, 0x4e, 0xb9, 0x2c, 0x16, 0xfc, 0x47,
+    0xb7, 0xce, 0x47, 0x01, 0x99, 0x7c, 0xfa, 0x4e, 0xf0, 0x2e, 0x0a, 0x6c, 0xb3, 0x4d, 0x82, 0xd3,
+    0x3d, 0xbe, 0x6a, 0x4f, 0xda, 0xe0, 0x8d, 0xa9, 0xc1, 0xb4, 0xf8, 0xe2, 0x04, 0x03, 0xcc, 0x8d,
+    0xc5, 0x81, 0x1d, 0xe6, 0x5d, 0x7e, 0x80, 0x13, 0x06, 0xb2, 0x6e, 0xaf, 0x7e, 0xae, 0xcc, 0x31,
+    0x6a, 0x8a, 0x69, 0xdb, 0x13, 0x00, 0x00, 0xff, 0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_3[] = {
+    0x6c, 0x90, 0x4d, 0x8e, 0xc2, 0x30, 0x0c, 0x85, 0xf7, 0x9c, 0xc2, 0xca, 0x8a, 0x91, 0x5a, 0x2a,
+    0xb1, 0x6e, 0xb3, 0x61, 0xe0, 0x00, 0x33, 0x9a, 0x03, 0x78, 0x52, 0x97, 0x89, 0x94, 0xc6, 0x51,
+    0xea, 0x20, 0x98, 0xd3, 0x93, 0xb6, 0x54, 0xe2, 0xcf, 0x9b, 0xc4, 0x9f, 0x9e, 0x5f, 0x5e, 0xac,
+    0x00, 0x93, 0xb0, 0xe1, 0x3e, 0x38, 0x12, 0x6a, 0x14, 0x77, 0x9d, 0x9a, 0x11, 0x06, 0x2b, 0xe8,
+    0xec, 0x7f, 0x86, 0x9e, 0x3d, 0xdd, 0x28, 0xc7, 0x48, 0x46, 0x66, 0x9d, 0x5e, 0xc1, 0x5d, 0xd5,
+    0x55, 0x6b, 0x4f, 0x7a, 0xf5, 0xc8, 0x32, 0x02, 0xe3, 0x70, 0x18, 0x1a, 0xd5, 0x71, 0xec, 0xcb,
+    0x63, 0xe4, 0x14, 0x9e, 0x06, 0x27, 0xa1, 0xc3, 0x5f, 0x72, 0x90, 0x35, 0x8d, 0x32, 0x9c, 0xbc,
+    0xc4, 0xcb, 0x8e, 0x5b, 0x52, 0x7a, 0x37, 0x37, 0x30, 0x76, 0x50, 0x0f, 0x01, 0xfd, 0xe2, 0xc7,
+    0x41, 0x2c, 0x7b, 0x74, 0xe5, 0x34, 0xaa, 0xf4, 0x7a, 0x01, 0x05, 0xd0, 0xe6, 0xb8, 0x29, 0xe0,
+    0xe7, 0xbb, 0x80, 0xcf, 0x7d, 0xf1, 0xf2, 0xd6, 0x52, 0x87, 0xaf, 0x8f, 0xba, 0x1a, 0x1d, 0x75,
+    0x5d, 0x4d, 0x1e, 0x6f, 0x62, 0x59, 0x1f, 0x92, 0x80, 0x5c, 0x42, 0xde, 0x82, 0xd0, 0x59, 0x14,
+    0xd8, 0xf6, 0x31, 0x21, 0x78, 0xec, 0xe9, 0x09, 0x05, 0x87, 0x86, 0xfe, 0xd8, 0xb5, 0x94, 0xbf,
+    0xb3, 0xf7, 0x42, 0x11, 0xb6, 0x65, 0xde, 0xef, 0x78, 0xb9, 0x09, 0xf3, 0x99, 0x95, 0x6f, 0xb3,
+    0x9d, 0xd0, 0xa5, 0xec, 0x78, 0x05, 0x00, 0x00, 0xff, 0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_4[] = {
+    0x6c, 0x51, 0xbd, 0x6e, 0x83, 0x30, 0x10, 0xde, 0xf3, 0x14, 0x27, 0x4f, 0x89, 0x54, 0xb0, 0xd4,
+    0x31, 0x05, 0xb6, 0x0e, 0x95, 0x3a, 0x55, 0xca, 0x03, 0x5c, 0xe0, 0x00, 0x4b, 0x87, 0x6d, 0xd9,
+    0x47, 0x04, 0x7d, 0xfa, 0x1a, 0x12, 0xa4, 0xa4, 0xc2, 0x93, 0xfd, 0xf9, 0xfb, 0xb3, 0x4f, 0x01,
+    0x8e, 0xe2, 0x6a, 0x37, 0x78, 0x26, 0xa1, 0x52, 0xb9, 0xb6, 0x55, 0x77, 0x08, 0xbd, 0x11, 0x64,
+    0xf3, 0x9b, 0x40, 0xeb, 0x2c, 0x3d, 0x50, 0x17, 0x02, 0xd5, 0x72, 0xe7, 0x1d, 0x60, 0x67, 0x0d,
+    0x38, 0x31, 0xd9, 0x4e, 0xfa, 0x52, 0xbd, 0x2b, 0x88, 0x32, 0x73, 0x32, 0x10, 0x9a, 0x24, 0x93,
+    0x80, 0x36, 0xb6, 0x2e, 0x0c, 0x67, 0x18, 0xbd, 0xa7, 0x50, 0x63, 0xa4, 0x0f, 0x55, 0xbd, 0xb8,
+    0x14, 0xba, 0x31, 0xb7, 0xea, 0xf0, 0x8a, 0x25, 0x08, 0x6a, 0xc6, 0x18, 0x4b, 0xb5, 0xc8, 0xb3,
+    0x2e, 0xb8, 0xd1, 0xff, 0x13, 0xae, 0x44, 0xc6, 0x2b, 0x31, 0x24, 0x4e, 0xa9, 0xcc, 0x80, 0x1d,
+    0x5d, 0x02, 0xab, 0xea, 0x6b, 0xd9, 0xc1, 0xe5, 0xe7, 0x1b, 0x8a, 0xe8, 0xd1, 0x6e, 0x4e, 0xce,
+    0x8b, 0x71, 0x16, 0x39, 0x5b, 0x45, 0xaa, 0x3a, 0x6e, 0xc0, 0xa9, 0xd0, 0x0b, 0xaf, 0x2a, 0xf4,
+    0x7a, 0xb3, 0x13, 0x63, 0xac, 0x1f, 0x05, 0x64, 0xf6, 0x8f, 0x97, 0x29, 0x30, 0xcd, 0x53, 0x22,
+    0x58, 0x1c, 0xe8, 0xe9, 0xbc, 0xfb, 0x4d, 0x9e, 0xb1, 0xa6, 0xde, 0x71, 0x43, 0xa9, 0xec, 0xa7,
+    0x15, 0x0a, 0x60, 0xb6, 0xa2, 0x11, 0x5c, 0x00, 0x5c, 0x28, 0x33, 0x9b, 0x28, 0x70, 0xa4, 0xbc,
+    0xcb, 0xdf, 0xa0, 0x17, 0xf1, 0xf1, 0xac, 0x35, 0x4d, 0xb8, 0x4c, 0x2b, 0x4f, 0x43, 0xd3, 0xab,
+    0x26, 0xbf, 0x0e, 0xfe, 0xb4, 0x1f, 0x73, 0x43, 0x1e, 0x53, 0x97, 0x3f, 0x00, 0x00, 0x00, 0xff,
+    0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_5[] = {
+    0x94, 0x53, 0x51, 0x6e, 0x13, 0x31, 0x10, 0xfd, 0xef, 0x29, 0x46, 0xcb, 0x4f, 0x22, 0x75, 0x13,
+    0x88, 0x2a, 0xa8, 0x92, 0x34, 0x52, 0x8a, 0x00, 0x05, 0xa8, 0x1a, 0x51, 0x38, 0xc0, 0xec, 0xee,
+    0xec, 0xc6, 0xaa, 0xd7, 0xb6, 0xec, 0xd9, 0xa4, 0xe1, 0x20, 0x3d, 0x0a, 0x07, 0xe2, 0x24, 0x8c,
+    0x77, 0xb7, 0x88, 0xb4, 0xc9, 0x07, 0xfe, 0xb2, 0x9f, 0xed, 0x79, 0xef, 0xcd, 0xb3, 0x13, 0xc0,
+    0x86, 0x6d, 0x6e, 0x6b, 0xa7, 0x89, 0xe9, 0x2a, 0xb1, 0x65, 0x99, 0x74, 0x10, 0x3a, 0xc5, 0xa8,
+    0xd5, 0x4f, 0x01, 0x8d, 0x35, 0xd4, 0xa3, 0xd6, 0x7b, 0xca, 0xb9, 0x3b, 0xb7, 0x38, 0x83, 0x67,
+    0x63, 0x1e, 0x6a, 0xd4, 0x1a, 0x02, 0xef, 0xb5, 0x5c, 0xcb, 0xad, 0xb6, 0x7e, 0x0a, 0xaf, 0xde,
+    0x66, 0xef, 0x26, 0x97, 0xaf, 0x67, 0x50, 0x5a, 0xc3, 0x69, 0x90, 0x8a, 0x53, 0x78, 0x33, 0x71,
+    0x0f, 0x33, 0xa8, 0xd1, 0x57, 0xca, 0xa4, 0x6c, 0xdd, 0x14, 0x2e, 0x22, 0x50, 0xa8, 0xe0, 0x34,
+    0xee, 0xa7, 0x90, 0x69, 0x9b, 0xdf, 0xcf, 0x8e, 0x30, 0xc4, 0x71, 0xd3, 0x04, 0x06, 0x4f, 0xdc,
+    0x78, 0x03, 0x08, 0x19, 0x06, 0xd2, 0xca, 0x10, 0x7c, 0x5e, 0x7f, 0xf8, 0x04, 0xd6, 0x03, 0x1a,
+    0x68, 0x4c, 0x74, 0xe4, 0x29, 0x04, 0x2a, 0x60, 0x72, 0x91, 0x66, 0x8a, 0xe3, 0xce, 0x65, 0x3b,
+    0xb9, 0xbe, 0x59, 0x43, 0xa9, 0x34, 0x8d, 0x60, 0xc5, 0xa0, 0x02, 0x84, 0x1c, 0xb5, 0x1c, 0x43,
+    0x53, 0x1c, 0x65, 0x2b, 0x14, 0x6f, 0xc8, 0xcb, 0x01, 0x6b, 0x40, 0x66, 0x50, 0xd0, 0x56, 0xe5,
+    0x24, 0x66, 0x7c, 0xbb, 0xa4, 0x54, 0x99, 0xfb, 0x27, 0xe1, 0x23, 0xb8, 0x23, 0x87, 0x1e, 0x99,
+    0x20, 0xd0, 0x96, 0x3c, 0x6a, 0xf8, 0xf1, 0xed, 0x6b, 0x80, 0x9d, 0xd4, 0x80, 0xe0, 0x30, 0xa7,
+    0x70, 0x1e, 0x85, 0xe8, 0x78, 0x07, 0x61, 0xc4, 0x0f, 0xdc, 0x4a, 0x11, 0x20, 0xb0, 0x32, 0x95,
+    0x70, 0x50, 0xbc, 0x01, 0x8e, 0xfc, 0x51, 0x31, 0xd1, 0xe8, 0x39, 0xb0, 0x85, 0xb0, 0xb1, 0x3b,
+    0xa9, 0x50, 0xa8, 0xb2, 0x14, 0x71, 0x46, 0x8c, 0xd4, 0x58, 0x51, 0xd4, 0x18, 0x79, 0xf7, 0xd2,
+    0x9e, 0x52, 0xec, 0x6f, 0x46, 0x2f, 0x23, 0x1a, 0xb7, 0x19, 0x1d, 0x76, 0x76, 0x3e, 0x2e, 0xd4,
+    0x76, 0x71, 0x76, 0x88, 0x09, 0x04, 0xb9, 0xc6, 0x10, 0xae, 0x12, 0x54, 0x12, 0x52, 0x55, 0x69,
+    0x4a, 0x83, 0xa4, 0xaf, 0xac, 0x39, 0x96, 0x7d, 0xd6, 0x30, 0xc7, 0x1e, 0xed, 0x9d, 0x64, 0xdf,
+    0x2d, 0x92, 0x97, 0x05, 0x32, 0x16, 0x54, 0x15, 0x11, 0xfa, 0xde, 0x22, 0xd7, 0x6c, 0x4e, 0xe4,
+    0x3c, 0x97, 0x8e, 0x99, 0x83, 0xb3, 0xab, 0x3c, 0x52, 0xff, 0x7e, 0xfc, 0x25, 0x2e, 0x64, 0x6f,
+    0x01, 0xef, 0xad, 0x29, 0x55, 0xd5, 0x78, 0x82, 0xe5, 0x0a, 0x3e, 0x12, 0xca, 0x9b, 0xa0, 0x00,
+    0x83, 0x5b, 0x17, 0x45, 0xa2, 0x1e, 0x1e, 0xb1, 0xdf, 0x29, 0xfb, 0x6f, 0xff, 0x79, 0xcb, 0xf4,
+    0xd7, 0x7f, 0x2f, 0xab, 0xe3, 0xbf, 0x3b, 0xdd, 0x94, 0x7f, 0x8a, 0xc8, 0x8b, 0xa9, 0xd3, 0xca,
+    0xdb, 0xc6, 0x9d, 0xf2, 0xab, 0x31, 0x23, 0x1d, 0x5f, 0x96, 0xfc, 0x2f, 0x47, 0x06, 0xd5, 0xd2,
+    0xa9, 0x2f, 0xb4, 0x4f, 0x16, 0xb7, 0xb2, 0x12, 0x83, 0xcb, 0xf5, 0x0a, 0x64, 0xdd, 0x37, 0xa6,
+    0x2f, 0x6b, 0x7b, 0xaf, 0x69, 0x7b, 0x3b, 0x59, 0x0c, 0x9e, 0x80, 0x61, 0xdf, 0xa4, 0xf9, 0xb8,
+    0xdd, 0x39, 0xc1, 0xa9, 0x8c, 0x6b, 0xb8, 0x0f, 0x8d, 0xe9, 0x81, 0x3b, 0x67, 0x07, 0xf4, 0x60,
+    0xb0, 0xa6, 0xe7, 0x98, 0x3c, 0xf7, 0x9c, 0x36, 0x56, 0x17, 0x24, 0x6a, 0x07, 0xf1, 0x37, 0x88,
+    0xc0, 0x9d, 0x24, 0x20, 0x9f, 0x25, 0x5a, 0xa0, 0x1c, 0x03, 0x0f, 0x93, 0xa3, 0xa4, 0x71, 0x6c,
+    0x51, 0x37, 0x52, 0xf4, 0x0f, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_6[] = {
+    0x74, 0x8f, 0x31, 0x6e, 0xc3, 0x30, 0x0c, 0x45, 0xf7, 0x9c, 0x82, 0xd0, 0x94, 0x00, 0x4e, 0x7d,
+    0x01, 0x5b, 0x40, 0xc7, 0x6c, 0x01, 0x7a, 0x02, 0x56, 0xa6, 0x53, 0x01, 0xb4, 0x28, 0x48, 0x54,
+    0x50, 0xe7, 0xf4, 0x51, 0xec, 0x66, 0x71, 0x13, 0x6e, 0x7c, 0xfc, 0xfc, 0xfc, 0x34, 0x80, 0x45,
+    0xc5, 0xc9, 0x14, 0x99, 0x94, 0x7a, 0x23, 0xe3, 0x68, 0x56, 0x84, 0xd1, 0x2b, 0xb2, 0xbf, 0x55,
+    0x18, 0x24, 0xd0, 0x1f, 0x95, 0x94, 0xc8, 0xe9, 0xaa, 0xb3, 0x3b, 0xd8, 0x54, 0xd7, 0x0e, 0xfe,
+    0x6a, 0x77, 0xff, 0x79, 0xc5, 0xe0, 0x18, 0x73, 0xee, 0xcd, 0x28, 0x69, 0x3a, 0x5e, 0x92, 0x94,
+    0xf8, 0xc2, 0x60, 0x11, 0x33, 0x7e, 0x13, 0x43, 0xd5, 0xf5, 0x06, 0xfd, 0x39, 0xd5, 0x6c, 0xfa,
+    0xa5, 0x33, 0x93, 0xb1, 0x9f, 0x27, 0x58, 0x7b, 0x58, 0x00, 0x74, 0x39, 0x62, 0x78, 0x1a, 0x4b,
+    0x54, 0x2f, 0x01, 0xf9, 0xb8, 0xec, 0x1b, 0xbb, 0x7f, 0x82, 0x43, 0xd7, 0x3e, 0x74, 0xb6, 0x6b,
+    0x97, 0xc9, 0x9b, 0xab, 0x3e, 0xc4, 0xa2, 0xa0, 0x73, 0xac, 0x0f, 0x2b, 0xfd, 0xaa, 0x01, 0x3f,
+    0x6c, 0x03, 0x40, 0xc0, 0x89, 0xb6, 0xf0, 0xa5, 0xdd, 0xa3, 0x22, 0xa3, 0xa3, 0x1f, 0xe1, 0x81,
+    0xea, 0x27, 0xfb, 0x40, 0x45, 0x13, 0x72, 0x03, 0x63, 0x09, 0x61, 0x6e, 0x20, 0x63, 0x72, 0x98,
+    0xd5, 0xbb, 0x06, 0x48, 0xdd, 0xc7, 0xc1, 0xc0, 0x15, 0xb9, 0x54, 0xf7, 0x3b, 0x00, 0x00, 0x00,
+    0xff, 0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_7[] = {
+    0x74, 0x90, 0x41, 0x4e, 0xc3, 0x40, 0x0c, 0x45, 0xf7, 0x3d, 0xc5, 0xc8, 0x2b, 0x58, 0xb4, 0xb3,
+    0x47, 0xc9, 0x48, 0x20, 0xb1, 0xe8, 0x01, 0x38, 0x80, 0x49, 0x1c, 0x3a, 0x92, 0x63, 0x5b, 0x33,
+    0x4e, 0x05, 0x9c, 0x9e, 0x21, 0xa5, 0x8b, 0xaa, 0xc4, 0xcb, 0xe7, 0xef, 0x6f, 0xfb, 0xc3, 0x2e,
+    0x6c, 0x14, 0x2e, 0xae, 0x83, 0xce, 0xc6, 0xe4, 0xd4, 0x83, 0x4e, 0x13, 0x5c, 0x10, 0x5a, 0x76,
+    0xe4, 0xfc, 0xdd, 0xa0, 0xa8, 0xd0, 0x1f, 0xd5, 0x52, 0x68, 0xf0, 0x8b, 0x2e, 0xdd, 0x79, 0x76,
+    0x71, 0xcc, 0xe7, 0xb4, 0xbb, 0xe7, 0x0d, 0x87, 0x81, 0xb1, 0xd6, 0x1e, 0x26, 0x2d, 0xf3, 0xfe,
+    0xa3, 0xe8, 0x62, 0xff, 0x18, 0xac, 0x62, 0xc6, 0x77, 0xe2, 0xd0, 0x74, 0x3d, 0x30, 0xcf, 0x2f,
+    0x58, 0xe9, 0xad, 0x30, 0xa4, 0xe7, 0x63, 0x78, 0x95, 0xd1, 0x34, 0x8b, 0x87, 0xae, 0x1a, 0xca,
+    0xd5, 0x51, 0xcd, 0xb3, 0x0a, 0xf2, 0x7e, 0x1d, 0x84, 0xf4, 0x70, 0x05, 0x8f, 0x5d, 0xfc, 0xd5,
+    0xa5, 0x2e, 0xae, 0x9d, 0x8d, 0x75, 0x59, 0x6c, 0xf1, 0xe0, 0x5f, 0xd6, 0x3e, 0x75, 0xfa, 0x74,
+    0x08, 0x79, 0xbc, 0xd9, 0x1c, 0x04, 0x67, 0xba, 0x25, 0xc6, 0x38, 0xd0, 0x49, 0x79, 0xa4, 0x76,
+    0xe4, 0xc9, 0xdd, 0xea, 0x53, 0x8c, 0x2d, 0xb1, 0x83, 0x1a, 0x09, 0xe6, 0x43, 0x0b, 0x14, 0x36,
+    0x13, 0x3f, 0x23, 0x2f, 0xcd, 0xef, 0x07, 0x00, 0x00, 0xff, 0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_8[] = {
+    0x74, 0x51, 0xc1, 0x6e, 0xc2, 0x30, 0x0c, 0xbd, 0xef, 0x2b, 0xac, 0xec, 0xb2, 0x1d, 0x4a, 0x07,
+    0x42, 0xdb, 0x54, 0xa0, 0x12, 0x47, 0x0e, 0xd3, 0x4e, 0xfb, 0x80, 0xb4, 0x35, 0x10, 0xe1, 0xc4,
+    0x51, 0xe2, 0x32, 0xba, 0xaf, 0x5f, 0x5a, 0x40, 0x42, 0x82, 0xfa, 0x94, 0x3c, 0xdb, 0xef, 0x3d,
+    0xdb, 0x0a, 0x74, 0x2b, 0x5c, 0xb3, 0xf5, 0x84, 0x82, 0x2b, 0xc5, 0xdb, 0xad, 0x3a, 0x43, 0xda,
+    0x1b, 0xd1, 0x64, 0xfe, 0x12, 0xe8, 0xd8, 0xe1, 0x05, 0xe5, 0x10, 0xb0, 0x96, 0x73, 0x5d, 0xf9,
+    0x04, 0x0f, 0x62, 0x19, 0xad, 0x26, 0x82, 0x28, 0x1d, 0xa5, 0xd6, 0x9a, 0x89, 0x43, 0x01, 0xcf,
+    0xef, 0xd5, 0xc7, 0xec, 0xf3, 0x6d, 0x01, 0x5b, 0x76, 0x92, 0xc5, 0xc4, 0x5a, 0xc0, 0x74, 0xe6,
+    0x4f, 0x0b, 0xb0, 0x3a, 0xec, 0x8c, 0xcb, 0x84, 0x7d, 0x01, 0xf3, 0x1e, 0x68, 0x4c, 0xf4, 0xa4,
+    0xbb, 0x02, 0x2a, 0xe2, 0xfa, 0xb0, 0x18, 0x51, 0xe9, 0x63, 0xed, 0x3a, 0xf8, 0xf6, 0xe8, 0xd6,
+    0x9b, 0xac, 0x1f, 0x40, 0x8b, 0xa9, 0x08, 0x21, 0x62, 0x38, 0x62, 0x98, 0xc0, 0x4f, 0x44, 0xd8,
+    0x8b, 0xf8, 0x22, 0xcf, 0x93, 0x6a, 0x00, 0x7d, 0xc9, 0x00, 0x3b, 0xe8, 0xb8, 0x0d, 0x90, 0xe8,
+    0x35, 0x81, 0x43, 0xf9, 0xe5, 0x70, 0x98, 0x3c, 0x9e, 0x25, 0x1f, 0x86, 0xb9, 0xb7, 0xb0, 0xcc,
+    0x1b, 0x73, 0x2c, 0x9f, 0xee, 0xf1, 0x04, 0x43, 0x4d, 0x3a, 0xc6, 0x95, 0x4a, 0xa2, 0x36, 0xdb,
+    0x05, 0x6e, 0xfd, 0xd8, 0xa6, 0x48, 0x57, 0x48, 0xbd, 0xb9, 0x95, 0x22, 0xb2, 0x5f, 0xdc, 0x20,
+    0xa9, 0x72, 0xbd, 0x81, 0xe1, 0x95, 0x16, 0xe9, 0xb5, 0xbb, 0x92, 0xb1, 0x17, 0xc3, 0x4e, 0x53,
+    0x36, 0xf4, 0xa8, 0xf2, 0xe5, 0x0a, 0xbc, 0x26, 0x8f, 0xa9, 0xae, 0x5c, 0xe6, 0x43, 0x66, 0x44,
+    0xc9, 0x38, 0xdf, 0x0a, 0x48, 0xe7, 0xd3, 0x49, 0x04, 0x4f, 0xa2, 0xc0, 0x34, 0x37, 0xa2, 0xe0,
+    0xb4, 0xc5, 0xdb, 0x7f, 0xba, 0x40, 0x8d, 0x7b, 0xa6, 0x06, 0x93, 0xb7, 0x9d, 0x97, 0x6c, 0x3e,
+    0x99, 0x66, 0xd6, 0x38, 0xa3, 0x46, 0xaf, 0x71, 0xd4, 0xd4, 0x26, 0x8e, 0x7f, 0x00, 0x00, 0x00,
+    0xff, 0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_9[] = {
+    0x74, 0x8f, 0xbd, 0x6e, 0xc3, 0x30, 0x0c, 0x84, 0xf7, 0x3c, 0x05, 0xc1, 0x29, 0x19, 0x02, 0x27,
+    0xed, 0x6a, 0x0b, 0xe8, 0xd8, 0xb9, 0x7d, 0x01, 0x46, 0xa6, 0x5b, 0x01, 0x94, 0x28, 0xe8, 0x27,
+    0x68, 0xfa, 0xf4, 0x95, 0xed, 0x64, 0x69, 0x5d, 0x2e, 0x04, 0xbe, 0x3b, 0xdc, 0x91, 0x08, 0x54,
+    0x8b, 0x5a, 0xf5, 0x51, 0xb8, 0xf0, 0x80, 0x3a, 0x4d, 0xb8, 0x22, 0x8a, 0xae, 0x90, 0xb8, 0xef,
+    0x06, 0x83, 0x06, 0xbe, 0x53, 0x4d, 0x89, 0x6d, 0x59, 0x7d, 0x66, 0x07, 0xbf, 0xa6, 0xef, 0x46,
+    0x77, 0x35, 0xbb, 0xbf, 0xbc, 0x61, 0xb0, 0x42, 0x39, 0x0f, 0x38, 0x69, 0xf2, 0xc7, 0x8f, 0xa4,
+    0x35, 0x6e, 0x04, 0x2c, 0x66, 0xa1, 0x0b, 0x0b, 0x34, 0xdf, 0x80, 0x22, 0xfe, 0xdd, 0x79, 0xd6,
+    0x5a, 0xde, 0xd8, 0x6a, 0x18, 0x33, 0x9a, 0x97, 0x57, 0xb8, 0x23, 0xd8, 0xe7, 0x15, 0x1e, 0xa0,
+    0xcf, 0x91, 0xc2, 0xa3, 0x41, 0x63, 0x71, 0x1a, 0x48, 0x8e, 0x4b, 0x10, 0x9a, 0xfd, 0x03, 0x1c,
+    0xfa, 0x6e, 0xf6, 0x99, 0xbe, 0x5b, 0x94, 0x7f, 0xea, 0x5d, 0x88, 0x2d, 0xbb, 0xdc, 0xe2, 0xfc,
+    0x79, 0xf5, 0x17, 0x4e, 0x08, 0x6e, 0xdc, 0xba, 0x05, 0x02, 0x79, 0xde, 0x14, 0xbc, 0x0b, 0x03,
+    0x9e, 0xdb, 0xa6, 0xaf, 0xb6, 0x9f, 0x4e, 0xb8, 0x59, 0x35, 0x4f, 0x14, 0xb2, 0xfc, 0xa9, 0x32,
+    0x72, 0x7b, 0xf7, 0xf9, 0x84, 0x70, 0x25, 0xa9, 0x2d, 0xf4, 0x07, 0x00, 0x00, 0xff, 0xff,
+};
+
+static const uint8_t CONFIG_PAGE_CHUNK_10[] = {
+    0xbd, 0x58, 0xdb, 0x6e, 0xdb, 0x38, 0x10, 0x7d, 0xcf, 0x57, 0x70, 0xfd, 0x22, 0x07, 0xab, 0xca,
+    0xe9, 0x02, 0x7d, 0x49, 0x6d, 0x03, 0xcd, 0x0d, 0x09, 0xb6, 0xdd, 0x04, 0x88, 0x9b, 0x77, 0x5a,
+    0xa2, 0xad, 0xd9, 0x48, 0xa2, 0x20, 0x52, 0x76, 0xdc, 0xc2, 0x5f, 0xb1, 0xc0, 0x3e, 0xed, 0x77,
+    0xec, 0x53, 0xbf, 0xa6, 0x5f, 0xb2, 0x43, 0xea, 0x62, 0x5d, 0x28, 0x59, 0x69, 0x81, 0xd5, 0x83,
+    0xa1, 0xcb, 0xcc, 0x99, 0xe1, 0x21, 0xcf, 0x70, 0xe8, 0xd1, 0xfc, 0x84, 0x34, 0xae, 0xe9, 0xc4,
+    0x83, 0x4d, 0xfd, 0x75, 0xfe, 0xaa, 0xfe, 0x6e, 0x99, 0x4a, 0xc9, 0x23, 0x22, 0x77, 0x31, 0x9b,
+    0x8d, 0x44, 0xba, 0x0c, 0x41, 0x8e, 0x88, 0x1b, 0x50, 0x21, 0x66, 0xa3, 0xa5, 0x8c, 0x46, 0x04,
+    0xbc, 0xe2, 0xfd, 0x05, 0x3e, 0xce, 0x1f, 0xe9, 0x86, 0x91, 0x4b, 0x1e, 0xad, 0x60, 0x9d, 0x26,
+    0x54, 0x02, 0x8f, 0xa6, 0x93, 0x0c, 0xe3, 0x10, 0x6c, 0x3a, 0x59, 0xf1, 0x24, 0xcc, 0x9e, 0xab,
+    0x41, 0xa7, 0xc2, 0x4d, 0x20, 0x96, 0x07, 0xc3, 0xc9, 0x84, 0x3c, 0x24, 0x6c, 0xc3, 0x22, 0x49,
+    0xbe, 0x70, 0x1e, 0x12, 0x4c, 0x04, 0xee, 0x1f, 0xc9, 0xd6, 0x67, 0x11, 0x59, 0x71, 0x37, 0x15,
+    0x10, 0xad, 0x09, 0x44, 0x71, 0x2a, 0x45, 0xe9, 0xe3, 0xe1, 0xfb, 0x10, 0x3d, 0x1c, 0xea, 0x79,
+    0xd7, 0xca, 0xf5, 0x23, 0x08, 0xc9, 0x22, 0x96, 0x8c, 0x2d, 0xc9, 0x53, 0xd7, 0x17, 0x92, 0x26,
+    0xd2, 0xb2, 0xc9, 0x2a, 0x8d, 0x5c, 0x95, 0x1e, 0x19, 0x9f, 0x92, 0xaf, 0x64, 0x6f, 0xe3, 0x4f,
+    0x8c, 0xa3, 0x82, 0x0d, 0x3b, 0x27, 0x32, 0x49, 0x19, 0xd9, 0x9f, 0xbe, 0x3f, 0xa9, 0x66, 0x72,
+    0x4b, 0x23, 0x2f, 0x60, 0xe4, 0xc3, 0x1d, 0x71, 0xab, 0xc3, 0x23, 0x92, 0xaf, 0xd7, 0x01, 0x6b,
+    0xc7, 0x5f, 0x33, 0x79, 0x1d, 0x30, 0x75, 0x7b, 0xb1, 0xbb, 0xf3, 0xc6, 0x16, 0x85, 0x85, 0xb6,
+    0x44, 0x9a, 0xac, 0x53, 0x43, 0x76, 0x6e, 0x00, 0xee, 0x73, 0x33, 0xb1, 0xda, 0x64, 0x60, 0x5c,
+    0x21, 0x09, 0x85, 0x47, 0x96, 0x19, 0xcc, 0xfa, 0x82, 0x65, 0x73, 0x90, 0x9b, 0x5a, 0x38, 0x96,
+    0x36, 0x52, 0x96, 0xf9, 0x9d, 0x7b, 0x0c, 0x6a, 0x51, 0xda, 0x99, 0x71, 0x40, 0x3c, 0x81, 0x80,
+    0x25, 0x92, 0x33, 0x3b, 0x64, 0xe7, 0xe8, 0x45, 0xa2, 0x86, 0xe7, 0xa0, 0x95, 0xa4, 0x10, 0x89,
+    0xb1, 0x25, 0x7c, 0xbe, 0xb5, 0xaa, 0xbc, 0xaa, 0x0b, 0x56, 0x64, 0x5c, 0x42, 0x34, 0xc7, 0xac,
+    0x2e, 0x13, 0x66, 0xc2, 0x42, 0xbe, 0x61, 0x07, 0xc4, 0xa6, 0xcf, 0x61, 0x6c, 0x06, 0xa7, 0x84,
+    0x4b, 0x2a, 0x99, 0x77, 0xc4, 0x4f, 0xb2, 0x17, 0x89, 0x2c, 0x4a, 0xb5, 0xfc, 0x66, 0xc4, 0xfa,
+    0xfe, 0xf7, 0xbf, 0x96, 0xc1, 0xde, 0x07, 0xe1, 0x40, 0x84, 0x33, 0x78, 0xbb, 0xf8, 0xf4, 0x51,
+    0xd9, 0x4d, 0x45, 0x4c, 0x23, 0x2d, 0x8b, 0x2a, 0x73, 0xa3, 0x39, 0xfa, 0x4f, 0x27, 0xea, 0xdb,
+    0xbc, 0xd4, 0x87, 0x5e, 0x4d, 0x37, 0x8c, 0x4a, 0xbc, 0x15, 0x64, 0x7c, 0x1f, 0xab, 0x41, 0xd2,
+    0xe0, 0xb4, 0x11, 0x67, 0x4f, 0x58, 0x20, 0xd8, 0x40, 0x62, 0x70, 0x61, 0xbd, 0x92, 0x15, 0xed,
+    0xf1, 0x83, 0x94, 0x7c, 0xfb, 0x19, 0x4a, 0x8a, 0x3a, 0x92, 0xc7, 0x56, 0x14, 0x7d, 0x2b, 0x28,
+    0xba, 0x05, 0xaf, 0xc6, 0x4e, 0x93, 0x92, 0xf2, 0xa9, 0x26, 0xd3, 0xce, 0x45, 0x9c, 0x49, 0xf6,
+    0x06, 0xcb, 0x8e, 0x51, 0x7b, 0x59, 0x01, 0x43, 0xf1, 0x51, 0xb1, 0x8b, 0xdc, 0x8a, 0x04, 0x5b,
+    0xeb, 0x91, 0x39, 0x71, 0x56, 0x91, 0xae, 0xd8, 0x8a, 0xa6, 0x81, 0x1c, 0x37, 0x57, 0x73, 0x26,
+    0x89, 0xb2, 0x22, 0xf6, 0x29, 0xab, 0x34, 0x32, 0xcb, 0x0a, 0x2b, 0x95, 0x4c, 0xc5, 0x15, 0x6c,
+    0x7a, 0x31, 0xb4, 0x51, 0x07, 0x80, 0x00, 0xaf, 0xd7, 0x17, 0xbf, 0x23, 0x1d, 0x1b, 0x1a, 0xa4,
+    0xcc, 0xe4, 0xaf, 0xea, 0xe1, 0x96, 0x27, 0xbd, 0x18, 0x85, 0x4d, 0x1f, 0x0e, 0x8f, 0x59, 0x44,
+    0xe1, 0x43, 0x0c, 0xbf, 0xb3, 0x5d, 0x1f, 0x56, 0xd5, 0xae, 0x0f, 0x8f, 0xc2, 0x43, 0xc2, 0xc3,
+    0x58, 0x3e, 0xca, 0x9d, 0xae, 0x39, 0x3d, 0xa5, 0xab, 0x62, 0xd8, 0x87, 0xe8, 0x82, 0xec, 0xcd,
+    0x4c, 0x7d, 0xef, 0xf5, 0xe7, 0x69, 0x24, 0x93, 0xdd, 0x25, 0xf7, 0x7a, 0xf3, 0xa9, 0x98, 0xf5,
+    0xa1, 0x41, 0x48, 0xd7, 0xec, 0x73, 0x12, 0xf4, 0x41, 0x15, 0x36, 0x7d, 0x38, 0x41, 0x10, 0x5e,
+    0x50, 0x71, 0x0c, 0xe9, 0x60, 0x75, 0x04, 0xeb, 0x13, 0xa6, 0x7d, 0x0c, 0x49, 0xdb, 0x1c, 0xc1,
+    0x59, 0x40, 0xc8, 0x78, 0x2a, 0xb1, 0x74, 0xf1, 0xc8, 0x13, 0x47, 0x00, 0xeb, 0xc6, 0x07, 0xe4,
+    0x1a, 0x74, 0x29, 0x24, 0xc7, 0x03, 0x41, 0x71, 0x17, 0x51, 0x4b, 0x56, 0x6d, 0xe2, 0xef, 0x3b,
+    0xcc, 0x1a, 0x75, 0x0c, 0x9b, 0x16, 0xec, 0x24, 0x1c, 0xc7, 0x69, 0x54, 0x99, 0x52, 0x81, 0x59,
+    0xb5, 0xfc, 0x83, 0x86, 0x6a, 0x7a, 0x73, 0xcd, 0x91, 0x80, 0x53, 0x0f, 0xdd, 0x3a, 0x7d, 0x8c,
+    0x41, 0xea, 0xcd, 0x43, 0x5f, 0x48, 0xa1, 0x16, 0xad, 0x1a, 0x50, 0x1c, 0x50, 0xb5, 0x38, 0xad,
+    0x55, 0xc0, 0x5e, 0xac, 0xc6, 0xc8, 0x71, 0x35, 0x19, 0xf6, 0x85, 0x8c, 0x6a, 0xd5, 0x64, 0x5d,
+    0x51, 0x49, 0xd1, 0x37, 0x62, 0x5b, 0x72, 0x93, 0x3f, 0x8e, 0x0d, 0x25, 0xbe, 0x30, 0x75, 0x68,
+    0x8c, 0x1a, 0x2c, 0x4a, 0x83, 0xad, 0x2b, 0xc8, 0x10, 0xf3, 0xb2, 0x0a, 0xd8, 0x65, 0xd1, 0x18,
+    0xe2, 0x56, 0x13, 0xbc, 0x5d, 0xab, 0x13, 0x43, 0xdc, 0xeb, 0xf2, 0xb6, 0xeb, 0x75, 0x61, 0x08,
+    0x80, 0x96, 0xb5, 0xad, 0xd5, 0x3f, 0xc8, 0xbc, 0x22, 0x5f, 0xbb, 0xaa, 0x79, 0x47, 0xf2, 0xcf,
+    0x68, 0x93, 0x5c, 0xa2, 0x8e, 0xc6, 0xa7, 0x43, 0xa0, 0x4a, 0xf9, 0xda, 0xa5, 0xda, 0x87, 0xb8,
+    0x55, 0xb4, 0x6a, 0x57, 0xe4, 0x3d, 0xd0, 0x35, 0x13, 0xa7, 0x5d, 0x6a, 0x79, 0xa0, 0x5b, 0x43,
+    0x82, 0x76, 0x5b, 0xc3, 0xcd, 0x3d, 0xf0, 0xb0, 0x06, 0x71, 0xe7, 0x8e, 0xf1, 0x46, 0x77, 0x86,
+    0x5b, 0x0a, 0xb8, 0x28, 0x99, 0x74, 0xfd, 0xb1, 0x35, 0x11, 0x78, 0x4e, 0x40, 0xa8, 0xf6, 0xda,
+    0x55, 0x57, 0xc8, 0xa4, 0xcf, 0xbd, 0x73, 0x62, 0x3d, 0xdc, 0x3f, 0x2e, 0x2c, 0xdb, 0x68, 0xb3,
+    0xe4, 0xde, 0xee, 0xbc, 0xcc, 0xb7, 0x65, 0xb2, 0x37, 0xe5, 0xa4, 0x3a, 0xcd, 0x22, 0x23, 0x87,
+    0x3f, 0x9f, 0x76, 0x84, 0xef, 0x97, 0xbd, 0x48, 0x5d, 0x97, 0x09, 0x61, 0x68, 0x7c, 0x7a, 0xe5,
+    0xff, 0xfd, 0x9f, 0xbf, 0xea, 0xe7, 0x22, 0xa2, 0x28, 0xf0, 0x7e, 0x21, 0x97, 0x01, 0xd7, 0xe7,
+    0x98, 0x2d, 0x44, 0x1e, 0xdf, 0x66, 0x15, 0xc1, 0x08, 0x6d, 0xd6, 0x7a, 0x71, 0xe5, 0xee, 0x2e,
+    0xa2, 0x31, 0x93, 0xc4, 0xb3, 0x46, 0xd2, 0xa5, 0x48, 0xbf, 0xa1, 0xad, 0xf9, 0xa9, 0x21, 0x74,
+    0x50, 0xb1, 0x6f, 0x4f, 0x4a, 0x57, 0x23, 0x9b, 0xb5, 0x8d, 0x09, 0xdf, 0xea, 0x4a, 0x75, 0x9d,
+    0x24, 0x1c, 0x9b, 0xb2, 0x1b, 0x0a, 0xaa, 0x92, 0x4b, 0xae, 0xc3, 0xd4, 0x0b, 0xa7, 0xa9, 0x4f,
+    0xdd, 0x9f, 0x98, 0xc7, 0xaa, 0xd0, 0x4c, 0xe3, 0xed, 0x9f, 0x66, 0xed, 0x66, 0x18, 0x59, 0x27,
+    0x3b, 0x3a, 0x6b, 0x95, 0x6a, 0xbb, 0xca, 0x93, 0x87, 0x80, 0xa1, 0x52, 0xf5, 0x0c, 0xd2, 0x35,
+    0x1e, 0x85, 0x1c, 0x13, 0xb0, 0x69, 0x13, 0x5b, 0x51, 0x24, 0xac, 0xcf, 0xb6, 0xbd, 0xc9, 0x34,
+    0x8e, 0xdf, 0xc3, 0x1a, 0xe7, 0xc3, 0xf9, 0x76, 0x03, 0x89, 0x4c, 0x69, 0x40, 0x9e, 0xd9, 0x6e,
+    0xc9, 0x29, 0x36, 0x7f, 0x38, 0xcd, 0x21, 0x5f, 0x42, 0xe5, 0x88, 0x1b, 0x30, 0xec, 0x51, 0x22,
+    0x90, 0x40, 0x83, 0x27, 0x60, 0xdb, 0x98, 0x27, 0xf2, 0x96, 0xc1, 0xda, 0x57, 0x19, 0xe4, 0xcb,
+    0x30, 0x6b, 0xff, 0xf5, 0xcb, 0x4a, 0x94, 0xb2, 0xaf, 0xf6, 0x75, 0xac, 0xc2, 0xf9, 0x12, 0x1f,
+    0xd7, 0xac, 0xe3, 0xb8, 0xeb, 0xa6, 0x49, 0x82, 0x83, 0xeb, 0x0d, 0xd0, 0xf6, 0xf2, 0xf5, 0x97,
+    0x2b, 0x58, 0xad, 0x18, 0x7a, 0xbb, 0x6a, 0x62, 0xcd, 0x19, 0xbf, 0xa9, 0x07, 0x30, 0x1c, 0x4d,
+    0x5b, 0x50, 0x73, 0xf2, 0xf6, 0xdd, 0x99, 0x69, 0x41, 0x21, 0x89, 0x4f, 0x4d, 0xf6, 0x00, 0xfb,
+    0x04, 0x78, 0x66, 0xc1, 0x4e, 0xef, 0x6e, 0x18, 0x8e, 0x7a, 0x7f, 0xa6, 0xba, 0x63, 0xd4, 0x67,
+    0x62, 0x96, 0x90, 0x18, 0xe5, 0xaf, 0x49, 0xc1, 0x13, 0xb2, 0x64, 0x14, 0x09, 0x5f, 0xe9, 0xe2,
+    0x96, 0x8f, 0xa1, 0x15, 0xa5, 0xec, 0x96, 0x94, 0x51, 0xde, 0x25, 0x84, 0x10, 0x95, 0x04, 0xd5,
+    0x09, 0xfb, 0x95, 0x58, 0xf1, 0x8b, 0x61, 0xb5, 0x99, 0x50, 0xfc, 0x02, 0xc2, 0xa2, 0xa9, 0xe4,
+    0x03, 0x9d, 0x68, 0x00, 0xeb, 0xe8, 0x4e, 0xb2, 0x50, 0x14, 0x3d, 0xca, 0x9b, 0xec, 0x2f, 0x96,
+    0x61, 0xee, 0x31, 0x1e, 0xc6, 0x50, 0x30, 0x0b, 0x1e, 0x2b, 0xf7, 0xb7, 0x67, 0xad, 0x64, 0x3b,
+    0x6b, 0x46, 0x07, 0xdb, 0xba, 0x00, 0x7a, 0x48, 0x34, 0x16, 0x7a, 0xc9, 0xf1, 0x88, 0xcd, 0x13,
+    0x58, 0x03, 0x9e, 0xaa, 0x89, 0x0e, 0x28, 0x5e, 0xcd, 0x27, 0x26, 0x75, 0xb6, 0xf1, 0xff, 0x3f,
+    0x0a, 0x5d, 0xfc, 0xca, 0x92, 0x1f, 0xa2, 0xef, 0x37, 0x03, 0x7d, 0x07, 0xbd, 0x1f, 0x96, 0x76,
+    0xae, 0xa1, 0xf6, 0x39, 0x18, 0x39, 0x83, 0x2f, 0x6a, 0x5f, 0x36, 0x09, 0xb4, 0x52, 0x72, 0x3b,
+    0x01, 0x90, 0x6c, 0x7c, 0xd6, 0x85, 0xc7, 0xd5, 0x4e, 0xbd, 0x7f, 0x68, 0x09, 0x26, 0xf3, 0x46,
+    0x62, 0x8c, 0xdf, 0x66, 0x73, 0xc3, 0x2c, 0xbf, 0xa6, 0xce, 0x34, 0x7d, 0xcd, 0x55, 0xa6, 0xc1,
+    0x8f, 0x4d, 0xde, 0x9d, 0x9d, 0x55, 0x5e, 0xee, 0xf3, 0xfb, 0xe9, 0xa4, 0xf8, 0x37, 0x72, 0x3a,
+    0x51, 0x84, 0xcf, 0x4f, 0xf0, 0xc6, 0x97, 0x61, 0x30, 0xff, 0x0f,
+};
+
+static const ConfigPageChunk CONFIG_PAGE_CHUNKS[] = {
+    {CONFIG_PAGE_CHUNK_0, 2132, 10019, 0x777c1beeu, "CURRENT_SSID"},
+    {CONFIG_PAGE_CHUNK_1, 168, 309, 0x1fee52a2u, "CURRENT_PASSWORD"},
+    {CONFIG_PAGE_CHUNK_2, 169, 295, 0x25101d33u, "CURRENT_CITY"},
+    {CONFIG_PAGE_CHUNK_3, 218, 410, 0x70b0f00cu, "CURRENT_COUNTRY_CODE"},
+    {CONFIG_PAGE_CHUNK_4, 257, 486, 0x64b54119u, "CURRENT_IMAGE_URL"},
+    {CONFIG_PAGE_CHUNK_5, 538, 1152, 0x5df9f307u, "CURRENT_OPENAI_KEY"},
+    {CONFIG_PAGE_CHUNK_6, 210, 403, 0x6ba907aeu, "CURRENT_AI_PROMPT_STYLE"},
+    {CONFIG_PAGE_CHUNK_7, 203, 403, 0x99f82dcbu, "CURRENT_LLM_BASE_URL"},
+    {CONFIG_PAGE_CHUNK_8, 306, 593, 0x86844757u, "CURRENT_LLM_MODEL"},
+    {CONFIG_PAGE_CHUNK_9, 207, 409, 0x5a652281u, "CURRENT_LLM_TIMEOUT"},
+    {CONFIG_PAGE_CHUNK_10, 1371, 5454, 0x4596aa4fu, nullptr},
+};
+
+static const size_t CONFIG_PAGE_CHUNK_COUNT = sizeof(CONFIG_PAGE_CHUNKS) / sizeof(ConfigPageChunk);
@@ -1,4 +1,5 @@
 #include <Arduino.h>
+#include <WiFi.h>
 #include <time.h>
 
 #include <memory>
@@ -9,11 +10,20 @@
 #include "ConfigurationScreen.h"
 #include "ConfigurationServer.h"
 #include "CurrentWeatherScreen.h"
+#include "DeviceState.h"
+#include "DisplayPreparation.h"
 #include "DisplayType.h"
+#include "ForecastCache.h"
+#include "ForecastPromptEncoder.h"
+#include "ImagePlaylist.h"
 #include "ImageScreen.h"
 #include "MessageScreen.h"
 #include "MeteogramWeatherScreen.h"
 #include "OpenMeteoAPI.h"
+#include "RefreshPolicy.h"
+#include "SummaryCache.h"
+#include "WakeScheduler.h"
+#include "WeatherSentenceGenerator.h"
 #include "WiFiConnection.h"
 #include "WifiErrorScreen.h"
 #include "battery.h"
@@ -21,31 +31,167 @@
 
 std::unique_ptr<ApplicationConfig> appConfig;
 ApplicationConfigStorage configStorage;
+DeviceState deviceState;
 
 const String aiWeatherPrompt =
-    "I will share a JSON payload with you from the Open Meteo API which has weather forecast data for the current "
-    "day. You have to summarize it into one sentence:\n"
-    "- 18 words or less\n"
+    "I will share the current weather and a table of the hourly forecast for the rest of the current day. For each "
+    "of the listed time slots, summarize the weather into one sentence as it should be read during that slot, and "
+    "reply only with a JSON array of these sentences in slot order:\n"
+    "- 18 words or less per sentence\n"
     "- include the rough temperature in the sentence\n"
-    "- forecast for the whole day is included in the sentence\n"
+    "- forecast for the rest of the day from that slot is included in the sentence\n"
     "- use the time of the day to make the sentence more interesting, but don't mention the exact time\n"
     "- don't mention the location\n"
-    "- only include the current weather and the forecast for the remaining day, not the past\n";
+    "- only include the weather from that slot onwards, not the past\n";
 
 DisplayType display(Epd2Type(/*CS=5*/ SS, /*DC=*/17, /*RST=*/16, /*BUSY=*/4));
 
 OpenMeteoAPI openMeteoAPI;
+ForecastCache forecastCache;
+SummaryCache summaryCache;
+WakeScheduler wakeScheduler;
+
+const uint32_t CURRENT_WEATHER_MAX_FORECAST_AGE_SECONDS = 900;
+const uint32_t METEOGRAM_MAX_FORECAST_AGE_SECONDS = 3600;
+const uint32_t MESSAGE_MAX_FORECAST_AGE_SECONDS = SummaryCache::SLOT_HOURS * 3600;
+const uint32_t CONFIGURATION_INACTIVITY_TIMEOUT_MILLIS = 5 * 60 * 1000;
+
+bool hasDisplayedWifiError = false;
 
 void goToSleep(uint64_t sleepTimeInSeconds);
 int displayCurrentScreen();
 void cycleToNextScreen();
 bool isButtonWakeup();
+bool isColdBoot();
 void updateConfiguration(const Configuration& config);
 void initializeDefaultConfig();
+void geocodeCurrentLocation();
+
+uint32_t maxForecastAgeSeconds() {
+  if (deviceState.currentScreenIndex() == METEOGRAM_SCREEN) {
+    return METEOGRAM_MAX_FORECAST_AGE_SECONDS;
+  }
+  if (deviceState.currentScreenIndex() == MESSAGE_SCREEN) {
+    return MESSAGE_MAX_FORECAST_AGE_SECONDS;
+  }
+  return CURRENT_WEATHER_MAX_FORECAST_AGE_SECONDS;
+}
+
+bool hasFreshCachedForecast() {
+  return forecastCache.isFresh(deviceState.latitude(), deviceState.longitude(), wakeScheduler.currentTimeUtc(),
+                               maxForecastAgeSeconds());
+}
+
+bool hasCachedSummaryForCachedForecast() {
+  if (!hasFreshCachedForecast()) {
+    return false;
+  }
+  WeatherForecast forecast = forecastCache.load(wakeScheduler.currentTimeUtc());
+  uint32_t forecastFingerprint = SummaryCache::forecastFingerprint(forecast, appConfig->aiPromptStyle);
+  return summaryCache.hasSummaryFor(forecastFingerprint, forecast.currentLocalTime);
+}
+
+bool currentScreenNeedsNetwork() {
+  switch (deviceState.currentScreenIndex()) {
+    case CONFIG_SCREEN:
+      return false;
+    case CURRENT_WEATHER_SCREEN:
+    case METEOGRAM_SCREEN:
+      return !hasFreshCachedForecast();
+    case MESSAGE_SCREEN:
+      return appConfig->hasLlmEndpoint() ? !hasCachedSummaryForCachedForecast() : !hasFreshCachedForecast();
+    case IMAGE_SCREEN:
+      return !ImagePlaylist(appConfig->imageUrl).hasPrefetchedImage();
+    default:
+      return true;
+  }
+}
+
+String composeSummaryOnDevice(const WeatherForecast& forecast) {
+  char sentence[WeatherSentenceGenerator::MAX_SENTENCE_LENGTH];
+  WeatherSentenceGenerator::generate(forecast, sentence, sizeof(sentence));
+  return String(sentence);
+}
+
+WeatherForecast getCurrentForecast() {
+  int64_t now = wakeScheduler.currentTimeUtc();
+  bool hasCachedForecast = forecastCache.hasForecastFor(deviceState.latitude(), deviceState.longitude());
+  bool canUseCachedForecast = hasFreshCachedForecast() || (!WiFi.isConnected() && hasCachedForecast);
+  if (canUseCachedForecast) {
+    Serial.println("Using cached forecast");
+    return forecastCache.load(now);
+  }
+
+  WeatherForecast forecast = openMeteoAPI.getForecast(deviceState.latitude(), deviceState.longitude());
+  if (forecast.isValid()) {
+    wakeScheduler.synchronizeClock(forecast.fetchedAtUtc, forecast.utcOffsetSeconds);
+    forecastCache.store(forecast, deviceState.latitude(), deviceState.longitude(), wakeScheduler.currentTimeUtc());
+  }
+  return forecast;
+}
+
+bool connectToNetworkIfNeeded() {
+  if (WiFi.isConnected() || !currentScreenNeedsNetwork()) {
+    return true;
+  }
+
+  WiFiConnection wifi(appConfig->wifiSSID, appConfig->wifiPassword);
+  wifi.connect();
+  if (!wifi.isConnected()) {
+    Serial.println("Failed to connect to WiFi");
+    return false;
+  }
+
+  if (!deviceState.hasCoordinates()) {
+    geocodeCurrentLocation();
+    configStorage.save(*appConfig);
+  }
+  return true;
+}
+
+bool isShowingWeather() {
+  switch (deviceState.currentScreenIndex()) {
+    case CURRENT_WEATHER_SCREEN:
+    case METEOGRAM_SCREEN:
+    case MESSAGE_SCREEN:
+      return true;
+    default:
+      return false;
+  }
+}
+
+uint32_t adjustRefreshInterval(uint32_t screenRefreshSeconds) {
+  if (deviceState.currentScreenIndex() == CONFIG_SCREEN) {
+    return screenRefreshSeconds;
+  }
+
+  WeatherForecast cachedForecast = {};
+  bool adaptsToWeather = isShowingWeather() && !hasDisplayedWifiError &&
+                         forecastCache.hasForecastFor(deviceState.latitude(), deviceState.longitude());
+  if (adaptsToWeather) {
+    cachedForecast = forecastCache.load(wakeScheduler.currentTimeUtc());
+  }
+
+  RefreshConditions conditions = {getBatteryVoltage(), wakeScheduler.currentLocalHour(),
+                                  adaptsToWeather ? &cachedForecast : nullptr};
+  uint32_t refreshSeconds = RefreshPolicy::refreshIntervalSeconds(screenRefreshSeconds, conditions);
+  Serial.printf("Refresh interval adjusted from %lu s to %lu s (battery %.2f V, hour %d)\n",
+                (unsigned long)screenRefreshSeconds, (unsigned long)refreshSeconds, conditions.batteryVoltage,
+                conditions.localHour);
+  return refreshSeconds;
+}
+
+int displayWifiError() {
+  hasDisplayedWifiError = true;
+  WifiErrorScreen errorScreen(display);
+  errorScreen.render();
+  return errorScreen.nextRefreshInSeconds();
+}
 
 void geocodeCurrentLocation() {
   if (strlen(appConfig->city) == 0) {
     Serial.println("No city configured, using default coordinates");
+    deviceState.setCoordinates(DEFAULT_LATITUDE, DEFAULT_LONGITUDE);
     return;
   }
 
@@ -54,16 +200,17 @@ void geocodeCurrentLocation() {
 
   GeocodingResult location = openMeteoAPI.getLocationByCity(String(appConfig->city), String(appConfig->countryCode));
   if (location.name.length() > 0) {
-    appConfig->latitude = location.latitude;
-    appConfig->longitude = location.longitude;
+    deviceState.setCoordinates(location.latitude, location.longitude);
+    configStorage.saveCoordinates(location.latitude, location.longitude);
 
     strncpy(appConfig->city, location.name.c_str(), sizeof(appConfig->city) - 1);
     strncpy(appConfig->countryCode, location.countryCode.c_str(), sizeof(appConfig->countryCode) - 1);
 
-    Serial.printf("Geocoded successfully: %s -> (%f, %f)\n", appConfig->city, appConfig->latitude,
-                  appConfig->longitude);
+    Serial.printf("Geocoded successfully: %s -> (%f, %f)\n", appConfig->city, deviceState.latitude(),
+                  deviceState.longitude());
   } else {
     Serial.printf("Geocoding failed for %s, using fallback coordinates\n", appConfig->city);
+    deviceState.setCoordinates(DEFAULT_LATITUDE, DEFAULT_LONGITUDE);
   }
 }
 
@@ -72,91 +219,151 @@ bool isButtonWakeup() {
   return (wakeupReason == ESP_SLEEP_WAKEUP_EXT0);
 }
 
-void cycleToNextScreen() {
-  appConfig->currentScreenIndex = (appConfig->currentScreenIndex + 1) % SCREEN_COUNT;
-
-  // Skip MESSAGE_SCREEN if no OpenAI API key is configured
-  if (appConfig->currentScreenIndex == MESSAGE_SCREEN && !appConfig->hasValidOpenaiApiKey()) {
-    appConfig->currentScreenIndex = (appConfig->currentScreenIndex + 1) % SCREEN_COUNT;
-  }
+bool isColdBoot() { return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_UNDEFINED; }
 
-  Serial.println("Cycled to screen: " + String(appConfig->currentScreenIndex));
+void cycleToNextScreen() {
+  deviceState.setCurrentScreenIndex((deviceState.currentScreenIndex() + 1) % SCREEN_COUNT);
 
-  configStorage.save(*appConfig);
+  Serial.println("Cycled to screen: " + String(deviceState.currentScreenIndex()));
 }
 
 int displayCurrentScreen() {
-  switch (appConfig->currentScreenIndex) {
+  switch (deviceState.currentScreenIndex()) {
     case CONFIG_SCREEN: {
       ConfigurationScreen configurationScreen(display);
       configurationScreen.render();
 
       Configuration currentConfig =
           Configuration(appConfig->wifiSSID, appConfig->wifiPassword, appConfig->openaiApiKey, appConfig->aiPromptStyle,
-                        appConfig->city, appConfig->countryCode, appConfig->imageUrl);
+                        appConfig->city, appConfig->countryCode, appConfig->imageUrl, appConfig->llmBaseUrl,
+                        appConfig->llmModel, String(appConfig->llmTimeoutSeconds));
       ConfigurationServer configurationServer(currentConfig);
 
       configurationServer.run(updateConfiguration);
-
-      while (configurationServer.isRunning()) {
-        configurationServer.handleRequests();
-
-        if (digitalRead(BUTTON_1) == LOW) {
-          delay(50);
-          if (digitalRead(BUTTON_1) == LOW) {
-            Serial.println("Button pressed - exiting configuration mode");
-            break;
-          }
-        }
-
-        delay(10);
+      if (!configurationServer.isRunning()) {
+        return configurationScreen.nextRefreshInSeconds();
       }
 
+      ConfigurationExitReason exitReason =
+          configurationServer.waitForExit(BUTTON_1, CONFIGURATION_INACTIVITY_TIMEOUT_MILLIS);
       configurationServer.stop();
-      return configurationScreen.nextRefreshInSeconds();
+
+      if (exitReason == CONFIGURATION_BUTTON_PRESSED) {
+        cycleToNextScreen();
+      } else {
+        deviceState.setCurrentScreenIndex(deviceState.lastContentScreenIndex());
+      }
+      return displayCurrentScreen();
     }
     case CURRENT_WEATHER_SCREEN: {
-      WeatherForecast forecastData = openMeteoAPI.getForecast(appConfig->latitude, appConfig->longitude);
+      WeatherForecast forecastData = {};
       CurrentWeatherScreen currentWeatherScreen(display, forecastData, String(appConfig->city),
                                                 String(appConfig->countryCode));
+      DisplayPreparation displayPreparation(currentWeatherScreen);
+      if (!connectToNetworkIfNeeded()) {
+        displayPreparation.waitUntilReady();
+        return displayWifiError();
+      }
+
+      forecastData = getCurrentForecast();
+      displayPreparation.waitUntilReady();
       currentWeatherScreen.render();
       return currentWeatherScreen.nextRefreshInSeconds();
     }
     case METEOGRAM_SCREEN: {
-      WeatherForecast forecastData = openMeteoAPI.getForecast(appConfig->latitude, appConfig->longitude);
+      WeatherForecast forecastData = {};
       MeteogramWeatherScreen meteogramWeatherScreen(display, forecastData);
+      DisplayPreparation displayPreparation(meteogramWeatherScreen);
+      if (!connectToNetworkIfNeeded()) {
+        displayPreparation.waitUntilReady();
+        return displayWifiError();
+      }
+
+      forecastData = getCurrentForecast();
+      displayPreparation.waitUntilReady();
       meteogramWeatherScreen.render();
       return meteogramWeatherScreen.nextRefreshInSeconds();
     }
     case MESSAGE_SCREEN: {
-      WeatherForecast forecastData = openMeteoAPI.getForecast(appConfig->latitude, appConfig->longitude);
+      MessageScreen messageScreen(display);
+      DisplayPreparation displayPreparation(messageScreen);
+      if (!connectToNetworkIfNeeded()) {
+        displayPreparation.waitUntilReady();
+        return displayWifiError();
+      }
 
-      String prompt = aiWeatherPrompt;
-      prompt += "- Use the following style: " + String(appConfig->aiPromptStyle) + "\n";
-      prompt += forecastData.apiPayload;
+      WeatherForecast forecastData = {};
+      if (WiFi.isConnected()) {
+        forecastData = openMeteoAPI.getForecast(deviceState.latitude(), deviceState.longitude());
+        if (forecastData.isValid()) {
+          wakeScheduler.synchronizeClock(forecastData.fetchedAtUtc, forecastData.utcOffsetSeconds);
+          forecastCache.store(forecastData, deviceState.latitude(), deviceState.longitude(),
+                              wakeScheduler.currentTimeUtc());
+        }
+      }
+      if (!forecastData.isValid() && forecastCache.hasForecastFor(deviceState.latitude(), deviceState.longitude())) {
+        Serial.println("Using cached forecast");
+        forecastData = forecastCache.load(wakeScheduler.currentTimeUtc());
+      }
 
-      ChatGPTClient chatGPTClient(appConfig->openaiApiKey);
-      String chatGPTResponse = chatGPTClient.generateContent(prompt);
+      uint32_t forecastFingerprint = SummaryCache::forecastFingerprint(forecastData, appConfig->aiPromptStyle);
+      String summary;
+      if (!appConfig->hasLlmEndpoint() || !forecastData.isValid()) {
+        summary = composeSummaryOnDevice(forecastData);
+      } else if (summaryCache.hasSummaryFor(forecastFingerprint, forecastData.currentLocalTime)) {
+        Serial.println("Forecast unchanged, reusing cached summary for this time slot");
+        summary = summaryCache.load(forecastData.currentLocalTime);
+      } else {
+        int firstSlot = SummaryCache::slotIndex(forecastData.currentLocalTime);
+        int slotCount = SummaryCache::remainingSlots(forecastData.currentLocalTime);
+
+        char forecastTable[ForecastPromptEncoder::MAX_ENCODED_LENGTH];
+        size_t forecastTableLength = ForecastPromptEncoder::encode(forecastData, forecastTable, sizeof(forecastTable));
+
+        String prompt;
+        prompt.reserve(aiWeatherPrompt.length() + strlen(appConfig->aiPromptStyle) + forecastTableLength + 128);
+        prompt += aiWeatherPrompt;
+        prompt += "- Use the following style: " + String(appConfig->aiPromptStyle) + "\n";
+        prompt += "Time slots:";
+        for (int slot = firstSlot; slot < firstSlot + slotCount; slot++) {
+          char slotLabel[16];
+          snprintf(slotLabel, sizeof(slotLabel), " %02d-%02dh", slot * SummaryCache::SLOT_HOURS,
+                   (slot + 1) * SummaryCache::SLOT_HOURS);
+          prompt += slotLabel;
+        }
+        prompt += "\n";
+        prompt += forecastTable;
+
+        ChatGPTClient chatGPTClient(appConfig->openaiApiKey, appConfig->llmBaseUrl, appConfig->llmModel,
+                                    appConfig->llmTimeoutSeconds * 1000UL);
+        std::vector<String> summaries;
+        if (chatGPTClient.generateSummaries(prompt, slotCount, SummaryCacheEntry::MAX_SUMMARY_LENGTH, summaries)) {
+          summary = summaries[0];
+          summaryCache.store(forecastFingerprint, forecastData.currentLocalTime, summaries);
+        } else {
+          Serial.println("No usable LLM response within the deadline, composing summary on device");
+          summary = composeSummaryOnDevice(forecastData);
+        }
+      }
 
-      MessageScreen messageScreen(display);
-      messageScreen.setMessageText(chatGPTResponse);
+      messageScreen.setMessageText(summary);
+      displayPreparation.waitUntilReady();
       messageScreen.render();
       return messageScreen.nextRefreshInSeconds();
     }
     case IMAGE_SCREEN: {
+      if (!connectToNetworkIfNeeded()) {
+        return displayWifiError();
+      }
+
       ImageScreen imageScreen(display, *appConfig);
       imageScreen.render();
       return imageScreen.nextRefreshInSeconds();
     }
     default: {
       Serial.println("Unknown screen index, defaulting to current weather");
-      appConfig->currentScreenIndex = CURRENT_WEATHER_SCREEN;
-
-      WeatherForecast forecastData = openMeteoAPI.getForecast(appConfig->latitude, appConfig->longitude);
-      CurrentWeatherScreen currentWeatherScreen(display, forecastData, String(appConfig->city),
-                                                String(appConfig->countryCode));
-      currentWeatherScreen.render();
-      return currentWeatherScreen.nextRefreshInSeconds();
+      deviceState.setCurrentScreenIndex(CURRENT_WEATHER_SCREEN);
+      return displayCurrentScreen();
     }
   }
 }
@@ -198,6 +405,22 @@ void updateConfiguration(const Configuration& config) {
     return;
   }
 
+  if (config.llmBaseUrl.length() >= sizeof(appConfig->llmBaseUrl)) {
+    Serial.println("Error: AI endpoint too long, maximum length is " + String(sizeof(appConfig->llmBaseUrl) - 1));
+    return;
+  }
+
+  if (config.llmBaseUrl.length() > 0 && !config.llmBaseUrl.startsWith("http://") &&
+      !config.llmBaseUrl.startsWith("https://")) {
+    Serial.println("Error: AI endpoint must start with http:// or https://");
+    return;
+  }
+
+  if (config.llmModel.length() >= sizeof(appConfig->llmModel)) {
+    Serial.println("Error: AI model too long, maximum length is " + String(sizeof(appConfig->llmModel) - 1));
+    return;
+  }
+
   bool locationChanged =
       (config.city != String(appConfig->city)) || (config.countryCode != String(appConfig->countryCode));
 
@@ -208,6 +431,8 @@ void updateConfiguration(const Configuration& config) {
   memset(appConfig->city, 0, sizeof(appConfig->city));
   memset(appConfig->countryCode, 0, sizeof(appConfig->countryCode));
   memset(appConfig->imageUrl, 0, sizeof(appConfig->imageUrl));
+  memset(appConfig->llmBaseUrl, 0, sizeof(appConfig->llmBaseUrl));
+  memset(appConfig->llmModel, 0, sizeof(appConfig->llmModel));
 
   strncpy(appConfig->wifiSSID, config.ssid.c_str(), sizeof(appConfig->wifiSSID) - 1);
   strncpy(appConfig->wifiPassword, config.password.c_str(), sizeof(appConfig->wifiPassword) - 1);
@@ -216,10 +441,17 @@ void updateConfiguration(const Configuration& config) {
   strncpy(appConfig->city, config.city.c_str(), sizeof(appConfig->city) - 1);
   strncpy(appConfig->countryCode, config.countryCode.c_str(), sizeof(appConfig->countryCode) - 1);
   strncpy(appConfig->imageUrl, config.imageUrl.c_str(), sizeof(appConfig->imageUrl) - 1);
+  strncpy(appConfig->llmBaseUrl, config.llmBaseUrl.length() > 0 ? config.llmBaseUrl.c_str() : DEFAULT_LLM_BASE_URL,
+          sizeof(appConfig->llmBaseUrl) - 1);
+  strncpy(appConfig->llmModel, config.llmModel.length() > 0 ? config.llmModel.c_str() : DEFAULT_LLM_MODEL,
+          sizeof(appConfig->llmModel) - 1);
+
+  long llmTimeoutSeconds = config.llmTimeoutSeconds.toInt();
+  appConfig->llmTimeoutSeconds = llmTimeoutSeconds > 0 ? min(llmTimeoutSeconds, 120L) : DEFAULT_LLM_TIMEOUT_SECONDS;
 
   if (locationChanged) {
-    appConfig->latitude = NAN;
-    appConfig->longitude = NAN;
+    deviceState.clearCoordinates();
+    configStorage.clearCoordinates();
     Serial.println("Location changed - coordinates will be re-geocoded on next startup");
   }
 
@@ -239,6 +471,8 @@ void updateConfiguration(const Configuration& config) {
   Serial.println("City: " + String(strlen(appConfig->city) > 0 ? appConfig->city : "[NOT SET]"));
   Serial.println("Country Code: " + String(strlen(appConfig->countryCode) > 0 ? appConfig->countryCode : "[NOT SET]"));
   Serial.println("Image URL: " + String(strlen(appConfig->imageUrl) > 0 ? appConfig->imageUrl : "[NOT SET]"));
+  Serial.println("AI Endpoint: " + String(appConfig->llmBaseUrl) + " (" + String(appConfig->llmModel) + ", " +
+                 String(appConfig->llmTimeoutSeconds) + " s timeout)");
 }
 
 void goToSleep(uint64_t sleepTimeInSeconds) {
@@ -262,13 +496,14 @@ void initializeDefaultConfig() {
                   strlen(appConfig->aiPromptStyle) > 0 ? appConfig->aiPromptStyle : "[NOT SET]");
     Serial.printf("  - City: %s\n", strlen(appConfig->city) > 0 ? appConfig->city : "[NOT SET]");
     Serial.printf("  - Country Code: %s\n", strlen(appConfig->countryCode) > 0 ? appConfig->countryCode : "[NOT SET]");
-    Serial.printf("  - Latitude: %f\n", appConfig->latitude);
-    Serial.printf("  - Longitude: %f\n", appConfig->longitude);
-    Serial.printf("  - Current Screen Index: %d\n", appConfig->currentScreenIndex);
   } else {
     appConfig.reset(new ApplicationConfig());
     Serial.println("Using default configuration");
   }
+
+  if (!deviceState.hasCoordinates()) {
+    configStorage.loadCoordinates(deviceState);
+  }
 }
 
 void setup() {
@@ -276,13 +511,17 @@ void setup() {
 
   initializeDefaultConfig();
 
+  deviceState.recordWake();
+  Serial.printf("Wake %lu, screen %d, coordinates (%f, %f)\n", (unsigned long)deviceState.wakeCount(),
+                deviceState.currentScreenIndex(), deviceState.latitude(), deviceState.longitude());
+
   pinMode(BATTERY_PIN, INPUT);
   pinMode(BUTTON_1, INPUT_PULLUP);
   SPI.begin(EPD_SCLK, EPD_MISO, EPD_MOSI);
 
-  if (!isButtonWakeup()) {
+  if (isColdBoot()) {
     if (!appConfig->hasValidWiFiCredentials()) {
-      appConfig->currentScreenIndex = CONFIG_SCREEN;
+      deviceState.setCurrentScreenIndex(CONFIG_SCREEN);
     }
   }
 
@@ -290,26 +529,8 @@ void setup() {
     cycleToNextScreen();
   }
 
-  if (appConfig->currentScreenIndex != CONFIG_SCREEN) {
-    WiFiConnection wifi(appConfig->wifiSSID, appConfig->wifiPassword);
-    wifi.connect();
-    if (!wifi.isConnected()) {
-      Serial.println("Failed to connect to WiFi");
-      WifiErrorScreen errorScreen(display);
-      errorScreen.render();
-      int refreshSeconds = errorScreen.nextRefreshInSeconds();
-      goToSleep(refreshSeconds);
-      return;
-    }
-
-    if (isnan(appConfig->latitude) || isnan(appConfig->longitude)) {
-      geocodeCurrentLocation();
-      configStorage.save(*appConfig);
-    }
-  }
-
   int refreshSeconds = displayCurrentScreen();
-  goToSleep(refreshSeconds);
+  goToSleep(wakeScheduler.secondsUntilNextWake(adjustRefreshInterval(refreshSeconds)));
 }
 
 void loop() {}
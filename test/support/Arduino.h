@@ -0,0 +1,145 @@
+#pragma once
+
+#include <ctype.h>
+#include <math.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+
+using std::max;
+using std::min;
+
+#define PROGMEM
+#define constrain(value, low, high) ((value) < (low) ? (low) : ((value) > (high) ? (high) : (value)))
+
+inline uint32_t& fakeMillis() {
+  static uint32_t currentMillis = 0;
+  return currentMillis;
+}
+
+inline uint32_t millis() { return fakeMillis(); }
+
+inline void delay(uint32_t milliseconds) { fakeMillis() += milliseconds; }
+
+class String {
+ public:
+  String() {}
+  String(const char* text) : text(text ? text : "") {}
+  String(const std::string& text) : text(text) {}
+  String(char c) : text(1, c) {}
+  String(int value) : text(std::to_string(value)) {}
+  String(unsigned int value) : text(std::to_string(value)) {}
+  String(long value) : text(std::to_string(value)) {}
+  String(unsigned long value) : text(std::to_string(value)) {}
+  String(double value, unsigned char decimals = 2) {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+    text = buffer;
+  }
+
+  unsigned int length() const { return text.length(); }
+  bool isEmpty() const { return text.empty(); }
+  const char* c_str() const { return text.c_str(); }
+  void reserve(unsigned int size) { text.reserve(size); }
+
+  char operator[](unsigned int index) const { return index < text.length() ? text[index] : 0; }
+  char& operator[](unsigned int index) { return text[index]; }
+
+  String& operator+=(const String& other) {
+    text += other.text;
+    return *this;
+  }
+  String& operator+=(const char* other) {
+    text += other;
+    return *this;
+  }
+  String& operator+=(char c) {
+    text += c;
+    return *this;
+  }
+
+  friend String operator+(const String& left, const String& right) { return String(left.text + right.text); }
+  friend String operator+(const String& left, const char* right) { return String(left.text + right); }
+  friend String operator+(const char* left, const String& right) { return String(left + right.text); }
+
+  bool operator==(const String& other) const { return text == other.text; }
+  bool operator==(const char* other) const { return text == other; }
+  bool operator!=(const String& other) const { return text != other.text; }
+  bool operator!=(const char* other) const { return text != other; }
+
+  bool startsWith(const String& prefix) const { return text.compare(0, prefix.text.length(), prefix.text) == 0; }
+  bool endsWith(const String& suffix) const {
+    return text.length() >= suffix.text.length() &&
+           text.compare(text.length() - suffix.text.length(), suffix.text.length(), suffix.text) == 0;
+  }
+
+  int indexOf(char c, unsigned int from = 0) const { return position(text.find(c, from)); }
+  int indexOf(const String& other, unsigned int from = 0) const { return position(text.find(other.text, from)); }
+  int lastIndexOf(char c) const { return position(text.rfind(c)); }
+
+  String substring(unsigned int from) const { return from < text.length() ? String(text.substr(from)) : String(); }
+  String substring(unsigned int from, unsigned int to) const {
+    return from < to && from < text.length() ? String(text.substr(from, to - from)) : String();
+  }
+
+  void remove(unsigned int index) {
+    if (index < text.length()) {
+      text.erase(index);
+    }
+  }
+  void remove(unsigned int index, unsigned int count) {
+    if (index < text.length()) {
+      text.erase(index, count);
+    }
+  }
+
+  void toLowerCase() {
+    for (char& c : text) {
+      c = tolower(c);
+    }
+  }
+
+  long toInt() const { return atol(text.c_str()); }
+
+ private:
+  std::string text;
+
+  static int position(size_t found) { return found == std::string::npos ? -1 : (int)found; }
+};
+
+class Stream {
+ public:
+  virtual ~Stream() {}
+  virtual int available() = 0;
+  virtual int read() = 0;
+
+  size_t readBytes(uint8_t* buffer, size_t length) {
+    size_t count = 0;
+    while (count < length) {
+      int c = read();
+      if (c < 0) {
+        break;
+      }
+      buffer[count++] = (uint8_t)c;
+    }
+    return count;
+  }
+
+  size_t readBytes(char* buffer, size_t length) { return readBytes(reinterpret_cast<uint8_t*>(buffer), length); }
+};
+
+class FakeSerial {
+ public:
+  void print(const String&) {}
+  void print(const char*) {}
+  void println(const String&) {}
+  void println(const char*) {}
+  void printf(const char*, ...) {}
+};
+
+inline FakeSerial Serial;
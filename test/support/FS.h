@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+class File {
+ public:
+  File() : position(0) {}
+  explicit File(std::shared_ptr<std::vector<uint8_t>> contents) : contents(contents), position(0) {}
+
+  explicit operator bool() const { return contents != nullptr; }
+
+  size_t read(uint8_t* buffer, size_t length) {
+    if (!contents) {
+      return 0;
+    }
+    size_t count = std::min(length, contents->size() - position);
+    memcpy(buffer, contents->data() + position, count);
+    position += count;
+    return count;
+  }
+
+  size_t write(const uint8_t* buffer, size_t length) {
+    if (!contents) {
+      return 0;
+    }
+    contents->insert(contents->end(), buffer, buffer + length);
+    return length;
+  }
+
+  void close() { contents.reset(); }
+
+ private:
+  std::shared_ptr<std::vector<uint8_t>> contents;
+  size_t position;
+};
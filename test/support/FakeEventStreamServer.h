@@ -0,0 +1,74 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+struct FakeServerChunk {
+  uint32_t arrivesAfterMillis;
+  std::string data;
+};
+
+struct FakeEventStreamServer {
+  bool acceptsConnections = true;
+  uint32_t connectMillis = 20;
+  uint32_t responseMillis = 100;
+  int responseCode = 200;
+  std::string errorBody;
+  std::vector<FakeServerChunk> chunks;
+
+  std::string connectedHost;
+  uint16_t connectedPort = 0;
+  uint32_t connectTimeoutMillis = 0;
+  std::string requestUrl;
+  std::string requestPayload;
+  std::map<std::string, std::string> requestHeaders;
+  uint32_t responseStartedMillis = 0;
+  size_t bytesRead = 0;
+  bool isStreaming = false;
+  bool wasClosedBeforeEnd = false;
+
+  void serveEvents(const std::vector<std::string>& events, uint32_t intervalMillis) {
+    chunks.clear();
+    for (size_t i = 0; i < events.size(); i++) {
+      chunks.push_back({(uint32_t)(i * intervalMillis), events[i]});
+    }
+  }
+
+  size_t totalBytes() const {
+    size_t total = 0;
+    for (const FakeServerChunk& chunk : chunks) {
+      total += chunk.data.size();
+    }
+    return total;
+  }
+
+  size_t arrivedBytes() const {
+    size_t arrived = 0;
+    for (const FakeServerChunk& chunk : chunks) {
+      if (millis() - responseStartedMillis >= chunk.arrivesAfterMillis) {
+        arrived += chunk.data.size();
+      }
+    }
+    return arrived;
+  }
+
+  int byteAt(size_t offset) const {
+    for (const FakeServerChunk& chunk : chunks) {
+      if (offset < chunk.data.size()) {
+        return (uint8_t)chunk.data[offset];
+      }
+      offset -= chunk.data.size();
+    }
+    return -1;
+  }
+};
+
+inline FakeEventStreamServer& fakeEventStreamServer() {
+  static FakeEventStreamServer server;
+  return server;
+}
+
+inline void resetFakeEventStreamServer() { fakeEventStreamServer() = FakeEventStreamServer(); }
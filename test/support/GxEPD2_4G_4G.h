@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+struct DrawnGreyRow {
+  int16_t x;
+  int16_t y;
+  int16_t width;
+  std::vector<uint8_t> packedRow;
+};
+
+class GxEPD2_213_flex {
+ public:
+  static const int16_t WIDTH = 122;
+  static const int16_t HEIGHT = 250;
+};
+
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_4G_4G {
+ public:
+  std::vector<DrawnGreyRow> drawnRows;
+
+  void drawGreyPixmap(const uint8_t pixmap[], int16_t depth, int16_t x, int16_t y, int16_t w, int16_t h) {
+    size_t rowBytes = (w * depth + 7) / 8;
+    for (int16_t row = 0; row < h; row++) {
+      const uint8_t* packedRow = pixmap + row * rowBytes;
+      drawnRows.push_back({x, (int16_t)(y + row), w, std::vector<uint8_t>(packedRow, packedRow + rowBytes)});
+    }
+  }
+};
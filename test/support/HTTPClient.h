@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "FakeEventStreamServer.h"
+#include "WiFiClient.h"
+
+static const int HTTP_CODE_OK = 200;
+static const int HTTPC_ERROR_READ_TIMEOUT = -11;
+
+class HTTPClient {
+ public:
+  void useHTTP10(bool) {}
+
+  bool begin(WiFiClient& client, const String& url) {
+    this->client = &client;
+    fakeEventStreamServer().requestUrl = url.c_str();
+    fakeEventStreamServer().requestHeaders.clear();
+    return true;
+  }
+
+  void addHeader(const String& name, const String& value) {
+    fakeEventStreamServer().requestHeaders[name.c_str()] = value.c_str();
+  }
+
+  void setTimeout(uint32_t timeoutMillis) { this->timeoutMillis = timeoutMillis; }
+
+  int POST(const String& payload) {
+    FakeEventStreamServer& server = fakeEventStreamServer();
+    server.requestPayload = payload.c_str();
+    if (server.responseMillis > timeoutMillis) {
+      delay(timeoutMillis);
+      return HTTPC_ERROR_READ_TIMEOUT;
+    }
+    delay(server.responseMillis);
+    server.responseStartedMillis = millis();
+    server.bytesRead = 0;
+    server.isStreaming = server.responseCode == HTTP_CODE_OK;
+    return server.responseCode;
+  }
+
+  String getString() { return String(fakeEventStreamServer().errorBody); }
+
+  WiFiClient* getStreamPtr() { return client; }
+
+  void end() {
+    if (client != nullptr) {
+      client->stop();
+      client = nullptr;
+    }
+  }
+
+ private:
+  WiFiClient* client = nullptr;
+  uint32_t timeoutMillis = 5000;
+};
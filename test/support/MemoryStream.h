@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <vector>
+
+class MemoryStream : public Stream {
+ public:
+  explicit MemoryStream(const std::vector<uint8_t>& data) : data(data), position(0) {}
+
+  int available() override { return (int)(data.size() - position); }
+  int read() override { return position < data.size() ? data[position++] : -1; }
+
+ private:
+  std::vector<uint8_t> data;
+  size_t position;
+};
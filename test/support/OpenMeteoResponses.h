@@ -0,0 +1,137 @@
+#pragma once
+
+static const char OPEN_METEO_OSLO_ONE_DAY_RESPONSE[] =
+    "{\"latitude\":59.92,\"longitude\":10.75,\"generationtime_ms\":0.0889301300048828,\"utc_offset_seconds\":7200"
+    ",\"timezone\":\"Europe/Oslo\",\"timezone_abbreviation\":\"CEST\",\"elevation\":23.0,\"current_units\":{\"tim"
+    "e\":\"iso8601\",\"interval\":\"seconds\",\"wind_speed_10m\":\"km/h\",\"wind_gusts_10m\":\"km/h\",\"temperatu"
+    "re_2m\":\"°C\",\"weather_code\":\"wmo code\",\"wind_direction_10m\":\"°\"},\"current\":{\"time\":\"2024-06"
+    "-01T13:15\",\"interval\":900,\"wind_speed_10m\":13.7,\"wind_gusts_10m\":29.5,\"temperature_2m\":17.4,\"weath"
+    "er_code\":3,\"wind_direction_10m\":214},\"hourly_units\":{\"time\":\"iso8601\",\"temperature_2m\":\"°C\",\""
+    "precipitation\":\"mm\",\"wind_speed_10m\":\"km/h\",\"wind_gusts_10m\":\"km/h\",\"cloud_cover_low\":\"%\"},\""
+    "hourly\":{\"time\":[\"2024-06-01T00:00\",\"2024-06-01T01:00\",\"2024-06-01T02:00\",\"2024-06-01T03:00\",\"20"
+    "24-06-01T04:00\",\"2024-06-01T05:00\",\"2024-06-01T06:00\",\"2024-06-01T07:00\",\"2024-06-01T08:00\",\"2024-"
+    "06-01T09:00\",\"2024-06-01T10:00\",\"2024-06-01T11:00\",\"2024-06-01T12:00\",\"2024-06-01T13:00\",\"2024-06-"
+    "01T14:00\",\"2024-06-01T15:00\",\"2024-06-01T16:00\",\"2024-06-01T17:00\",\"2024-06-01T18:00\",\"2024-06-01T"
+    "19:00\",\"2024-06-01T20:00\",\"2024-06-01T21:00\",\"2024-06-01T22:00\",\"2024-06-01T23:00\"],\"temperature_2"
+    "m\":[8.9,8.8,7.2,8.6,7.6,7.7,9.1,10.9,11.8,14.8,16.7,17.5,19.0,20.0,20.5,20.4,19.8,19.7,18.2,17.9,15.7,15.1,"
+    "13.4,11.1],\"precipitation\":[0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,1.1,0.7,0.5,0.4,0.5,1.8,0.0,0."
+    "0,0.0,0.0,0.0,0.0],\"wind_speed_10m\":[10.5,10.0,9.4,9.9,13.3,12.7,12.9,13.6,14.0,14.8,16.1,16.0,15.1,16.2,1"
+    "5.2,16.2,16.4,16.8,17.9,15.6,16.2,14.6,16.6,15.4],\"wind_gusts_10m\":[21.6,19.9,19.8,18.5,28.5,27.5,20.9,23."
+    "7,24.8,29.4,26.9,34.6,29.5,26.3,29.3,30.9,26.5,30.8,36.9,29.8,28.5,30.2,34.6,25.2],\"cloud_cover_low\":[42,6"
+    "5,62,77,62,79,79,83,81,88,94,97,100,90,100,100,74,72,78,84,65,66,50,53]}}";
+
+static const char OPEN_METEO_OSLO_THREE_DAY_RESPONSE[] =
+    "{\"latitude\":59.92,\"longitude\":10.75,\"generationtime_ms\":0.0889301300048828,\"utc_offset_seconds\":7200"
+    ",\"timezone\":\"Europe/Oslo\",\"timezone_abbreviation\":\"CEST\",\"elevation\":23.0,\"current_units\":{\"tim"
+    "e\":\"iso8601\",\"interval\":\"seconds\",\"wind_speed_10m\":\"km/h\",\"wind_gusts_10m\":\"km/h\",\"temperatu"
+    "re_2m\":\"°C\",\"weather_code\":\"wmo code\",\"wind_direction_10m\":\"°\"},\"current\":{\"time\":\"2024-06"
+    "-01T13:15\",\"interval\":900,\"wind_speed_10m\":13.7,\"wind_gusts_10m\":29.5,\"temperature_2m\":17.4,\"weath"
+    "er_code\":3,\"wind_direction_10m\":214},\"hourly_units\":{\"time\":\"iso8601\",\"temperature_2m\":\"°C\",\""
+    "precipitation\":\"mm\",\"wind_speed_10m\":\"km/h\",\"wind_gusts_10m\":\"km/h\",\"cloud_cover_low\":\"%\"},\""
+    "hourly\":{\"time\":[\"2024-06-01T00:00\",\"2024-06-01T01:00\",\"2024-06-01T02:00\",\"2024-06-01T03:00\",\"20"
+    "24-06-01T04:00\",\"2024-06-01T05:00\",\"2024-06-01T06:00\",\"2024-06-01T07:00\",\"2024-06-01T08:00\",\"2024-"
+    "06-01T09:00\",\"2024-06-01T10:00\",\"2024-06-01T11:00\",\"2024-06-01T12:00\",\"2024-06-01T13:00\",\"2024-06-"
+    "01T14:00\",\"2024-06-01T15:00\",\"2024-06-01T16:00\",\"2024-06-01T17:00\",\"2024-06-01T18:00\",\"2024-06-01T"
+    "19:00\",\"2024-06-01T20:00\",\"2024-06-01T21:00\",\"2024-06-01T22:00\",\"2024-06-01T23:00\",\"2024-06-02T00:"
+    "00\",\"2024-06-02T01:00\",\"2024-06-02T02:00\",\"2024-06-02T03:00\",\"2024-06-02T04:00\",\"2024-06-02T05:00\""
+    ",\"2024-06-02T06:00\",\"2024-06-02T07:00\",\"2024-06-02T08:00\",\"2024-06-02T09:00\",\"2024-06-02T10:00\",\""
+    "2024-06-02T11:00\",\"2024-06-02T12:00\",\"2024-06-02T13:00\",\"2024-06-02T14:00\",\"2024-06-02T15:00\",\"202"
+    "4-06-02T16:00\",\"2024-06-02T17:00\",\"2024-06-02T18:00\",\"2024-06-02T19:00\",\"2024-06-02T20:00\",\"2024-0"
+    "6-02T21:00\",\"2024-06-02T22:00\",\"2024-06-02T23:00\",\"2024-06-03T00:00\",\"2024-06-03T01:00\",\"2024-06-0"
+    "3T02:00\",\"2024-06-03T03:00\",\"2024-06-03T04:00\",\"2024-06-03T05:00\",\"2024-06-03T06:00\",\"2024-06-03T0"
+    "7:00\",\"2024-06-03T08:00\",\"2024-06-03T09:00\",\"2024-06-03T10:00\",\"2024-06-03T11:00\",\"2024-06-03T12:0"
+    "0\",\"2024-06-03T13:00\",\"2024-06-03T14:00\",\"2024-06-03T15:00\",\"2024-06-03T16:00\",\"2024-06-03T17:00\""
+    ",\"2024-06-03T18:00\",\"2024-06-03T19:00\",\"2024-06-03T20:00\",\"2024-06-03T21:00\",\"2024-06-03T22:00\",\""
+    "2024-06-03T23:00\"],\"temperature_2m\":[9.1,9.1,7.6,8.8,8.5,9.2,9.3,11.5,12.2,14.9,16.7,17.0,18.4,20.4,20.8,"
+    "20.2,18.8,19.8,18.8,17.0,15.8,14.3,12.0,10.9,9.5,8.2,9.0,7.4,8.1,8.8,8.2,10.0,11.7,13.1,15.3,17.3,18.3,18.6,"
+    "20.3,18.9,20.1,18.3,17.7,15.4,15.0,14.2,11.5,10.8,9.9,9.0,6.6,7.0,6.8,7.6,8.2,11.0,10.6,13.0,13.7,17.3,17.0,"
+    "18.1,19.5,19.5,18.8,18.9,16.4,17.2,14.2,13.6,12.2,9.0],\"precipitation\":[0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0."
+    "0,0.0,0.0,0.0,1.6,1.1,0.9,0.2,1.4,1.5,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0."
+    "0,0.0,1.5,0.6,1.4,1.0,1.3,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.3,0.0,0."
+    "4,1.3,0.4,0.6,0.0,0.0,0.0,0.0,0.0,0.0],\"wind_speed_10m\":[9.6,8.8,10.0,11.3,13.1,11.3,11.7,14.8,15.1,13.4,1"
+    "4.8,15.0,16.3,15.0,16.8,15.0,16.2,15.1,16.0,17.9,14.9,15.1,17.2,15.6,15.6,15.5,14.5,14.2,12.1,12.4,11.0,11.6"
+    ",10.6,10.1,10.6,9.0,9.9,10.0,10.8,13.3,13.7,12.7,13.6,15.7,16.1,16.2,15.1,15.2,16.7,16.5,15.8,17.8,17.6,15.6"
+    ",17.2,14.7,15.3,15.7,14.3,16.1,14.2,13.7,12.5,12.8,12.6,11.3,11.2,10.5,10.1,10.7,10.3,9.6],\"wind_gusts_10m\""
+    ":[17.5,14.1,22.0,22.4,25.1,23.2,24.8,30.0,28.2,22.5,29.2,27.2,35.2,31.7,29.0,31.7,27.4,29.7,34.1,32.0,25.6,2"
+    "4.5,36.8,31.0,33.8,27.0,28.0,22.9,23.9,25.1,22.1,22.7,19.3,20.8,18.9,15.4,17.8,18.0,18.1,22.7,24.8,23.0,29.3"
+    ",33.4,34.7,32.4,26.2,31.7,36.0,26.5,31.6,35.0,33.2,30.0,37.0,29.1,26.9,32.4,23.9,26.6,28.2,22.9,21.3,26.6,25"
+    ".5,21.7,20.8,22.5,16.9,22.2,17.1,19.8],\"cloud_cover_low\":[53,67,63,60,84,85,86,100,100,89,93,100,100,100,1"
+    "00,100,81,69,91,58,61,68,46,45,36,23,8,20,11,15,18,0,3,0,0,0,14,12,13,10,11,26,25,57,41,57,51,57,89,90,88,87"
+    ",100,100,100,100,100,82,82,92,90,84,73,74,61,62,61,51,45,34,25,3]}}";
+
+static const char OPEN_METEO_OSLO_SEVEN_DAY_RESPONSE[] =
+    "{\"latitude\":59.92,\"longitude\":10.75,\"generationtime_ms\":0.0889301300048828,\"utc_offset_seconds\":7200"
+    ",\"timezone\":\"Europe/Oslo\",\"timezone_abbreviation\":\"CEST\",\"elevation\":23.0,\"current_units\":{\"tim"
+    "e\":\"iso8601\",\"interval\":\"seconds\",\"wind_speed_10m\":\"km/h\",\"wind_gusts_10m\":\"km/h\",\"temperatu"
+    "re_2m\":\"°C\",\"weather_code\":\"wmo code\",\"wind_direction_10m\":\"°\"},\"current\":{\"time\":\"2024-06"
+    "-01T13:15\",\"interval\":900,\"wind_speed_10m\":13.7,\"wind_gusts_10m\":29.5,\"temperature_2m\":17.4,\"weath"
+    "er_code\":3,\"wind_direction_10m\":214},\"hourly_units\":{\"time\":\"iso8601\",\"temperature_2m\":\"°C\",\""
+    "precipitation\":\"mm\",\"wind_speed_10m\":\"km/h\",\"wind_gusts_10m\":\"km/h\",\"cloud_cover_low\":\"%\"},\""
+    "hourly\":{\"time\":[\"2024-06-01T00:00\",\"2024-06-01T01:00\",\"2024-06-01T02:00\",\"2024-06-01T03:00\",\"20"
+    "24-06-01T04:00\",\"2024-06-01T05:00\",\"2024-06-01T06:00\",\"2024-06-01T07:00\",\"2024-06-01T08:00\",\"2024-"
+    "06-01T09:00\",\"2024-06-01T10:00\",\"2024-06-01T11:00\",\"2024-06-01T12:00\",\"2024-06-01T13:00\",\"2024-06-"
+    "01T14:00\",\"2024-06-01T15:00\",\"2024-06-01T16:00\",\"2024-06-01T17:00\",\"2024-06-01T18:00\",\"2024-06-01T"
+    "19:00\",\"2024-06-01T20:00\",\"2024-06-01T21:00\",\"2024-06-01T22:00\",\"2024-06-01T23:00\",\"2024-06-02T00:"
+    "00\",\"2024-06-02T01:00\",\"2024-06-02T02:00\",\"2024-06-02T03:00\",\"2024-06-02T04:00\",\"2024-06-02T05:00\""
+    ",\"2024-06-02T06:00\",\"2024-06-02T07:00\",\"2024-06-02T08:00\",\"2024-06-02T09:00\",\"2024-06-02T10:00\",\""
+    "2024-06-02T11:00\",\"2024-06-02T12:00\",\"2024-06-02T13:00\",\"2024-06-02T14:00\",\"2024-06-02T15:00\",\"202"
+    "4-06-02T16:00\",\"2024-06-02T17:00\",\"2024-06-02T18:00\",\"2024-06-02T19:00\",\"2024-06-02T20:00\",\"2024-0"
+    "6-02T21:00\",\"2024-06-02T22:00\",\"2024-06-02T23:00\",\"2024-06-03T00:00\",\"2024-06-03T01:00\",\"2024-06-0"
+    "3T02:00\",\"2024-06-03T03:00\",\"2024-06-03T04:00\",\"2024-06-03T05:00\",\"2024-06-03T06:00\",\"2024-06-03T0"
+    "7:00\",\"2024-06-03T08:00\",\"2024-06-03T09:00\",\"2024-06-03T10:00\",\"2024-06-03T11:00\",\"2024-06-03T12:0"
+    "0\",\"2024-06-03T13:00\",\"2024-06-03T14:00\",\"2024-06-03T15:00\",\"2024-06-03T16:00\",\"2024-06-03T17:00\""
+    ",\"2024-06-03T18:00\",\"2024-06-03T19:00\",\"2024-06-03T20:00\",\"2024-06-03T21:00\",\"2024-06-03T22:00\",\""
+    "2024-06-03T23:00\",\"2024-06-04T00:00\",\"2024-06-04T01:00\",\"2024-06-04T02:00\",\"2024-06-04T03:00\",\"202"
+    "4-06-04T04:00\",\"2024-06-04T05:00\",\"2024-06-04T06:00\",\"2024-06-04T07:00\",\"2024-06-04T08:00\",\"2024-0"
+    "6-04T09:00\",\"2024-06-04T10:00\",\"2024-06-04T11:00\",\"2024-06-04T12:00\",\"2024-06-04T13:00\",\"2024-06-0"
+    "4T14:00\",\"2024-06-04T15:00\",\"2024-06-04T16:00\",\"2024-06-04T17:00\",\"2024-06-04T18:00\",\"2024-06-04T1"
+    "9:00\",\"2024-06-04T20:00\",\"2024-06-04T21:00\",\"2024-06-04T22:00\",\"2024-06-04T23:00\",\"2024-06-05T00:0"
+    "0\",\"2024-06-05T01:00\",\"2024-06-05T02:00\",\"2024-06-05T03:00\",\"2024-06-05T04:00\",\"2024-06-05T05:00\""
+    ",\"2024-06-05T06:00\",\"2024-06-05T07:00\",\"2024-06-05T08:00\",\"2024-06-05T09:00\",\"2024-06-05T10:00\",\""
+    "2024-06-05T11:00\",\"2024-06-05T12:00\",\"2024-06-05T13:00\",\"2024-06-05T14:00\",\"2024-06-05T15:00\",\"202"
+    "4-06-05T16:00\",\"2024-06-05T17:00\",\"2024-06-05T18:00\",\"2024-06-05T19:00\",\"2024-06-05T20:00\",\"2024-0"
+    "6-05T21:00\",\"2024-06-05T22:00\",\"2024-06-05T23:00\",\"2024-06-06T00:00\",\"2024-06-06T01:00\",\"2024-06-0"
+    "6T02:00\",\"2024-06-06T03:00\",\"2024-06-06T04:00\",\"2024-06-06T05:00\",\"2024-06-06T06:00\",\"2024-06-06T0"
+    "7:00\",\"2024-06-06T08:00\",\"2024-06-06T09:00\",\"2024-06-06T10:00\",\"2024-06-06T11:00\",\"2024-06-06T12:0"
+    "0\",\"2024-06-06T13:00\",\"2024-06-06T14:00\",\"2024-06-06T15:00\",\"2024-06-06T16:00\",\"2024-06-06T17:00\""
+    ",\"2024-06-06T18:00\",\"2024-06-06T19:00\",\"2024-06-06T20:00\",\"2024-06-06T21:00\",\"2024-06-06T22:00\",\""
+    "2024-06-06T23:00\",\"2024-06-07T00:00\",\"2024-06-07T01:00\",\"2024-06-07T02:00\",\"2024-06-07T03:00\",\"202"
+    "4-06-07T04:00\",\"2024-06-07T05:00\",\"2024-06-07T06:00\",\"2024-06-07T07:00\",\"2024-06-07T08:00\",\"2024-0"
+    "6-07T09:00\",\"2024-06-07T10:00\",\"2024-06-07T11:00\",\"2024-06-07T12:00\",\"2024-06-07T13:00\",\"2024-06-0"
+    "7T14:00\",\"2024-06-07T15:00\",\"2024-06-07T16:00\",\"2024-06-07T17:00\",\"2024-06-07T18:00\",\"2024-06-07T1"
+    "9:00\",\"2024-06-07T20:00\",\"2024-06-07T21:00\",\"2024-06-07T22:00\",\"2024-06-07T23:00\"],\"temperature_2m"
+    "\":[9.3,8.9,7.1,7.8,8.5,9.9,8.9,10.2,12.6,14.4,15.4,16.4,18.8,19.8,20.4,20.2,19.7,20.4,17.1,15.9,15.3,14.1,1"
+    "1.9,12.1,8.7,7.2,8.9,8.0,8.7,7.5,8.7,9.4,10.9,13.0,16.0,15.6,18.6,17.9,20.3,20.3,20.1,19.4,16.7,17.7,16.2,12"
+    ".9,12.9,9.6,9.6,7.6,7.2,6.3,6.6,7.6,10.1,10.0,11.1,12.6,14.4,16.0,17.5,19.1,18.6,19.3,19.1,18.4,17.4,17.3,15"
+    ".6,12.2,12.3,10.6,7.9,8.8,7.0,7.3,5.8,6.6,7.6,9.2,12.0,13.0,14.8,16.1,16.0,19.0,17.7,18.3,18.2,18.1,17.8,15."
+    "5,14.0,12.6,10.2,8.8,7.6,6.4,7.7,5.9,6.5,6.0,7.1,9.6,11.4,13.6,12.9,16.0,16.7,18.5,17.3,18.7,18.9,16.6,17.2,"
+    "15.4,14.6,11.6,11.0,9.8,7.8,7.7,5.0,5.9,5.5,7.9,8.7,9.0,10.3,11.6,14.4,16.0,17.4,16.1,17.2,19.1,18.9,17.1,17"
+    ".3,14.5,13.9,11.2,10.4,8.9,7.0,6.6,5.6,4.5,5.8,5.9,8.4,7.5,10.3,12.4,12.2,15.7,15.7,17.8,17.7,17.8,16.9,16.7"
+    ",15.4,14.4,12.5,12.0,10.1,9.4],\"precipitation\":[0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.2,0.0,0."
+    "9,0.9,1.1,1.4,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.8,1.1,0.8,1.8,0."
+    "1,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.7,0.1,1.3,0.7,0.0,0.0,0."
+    "0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,1.5,0.2,0.0,1.3,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0."
+    "0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,1.4,1.1,0.4,1.0,1.2,1.2,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0."
+    "0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.9,0.0,0.2,1.5,0.8,1.3,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,0."
+    "0,0.0,0.0,0.0,0.0,0.0,0.0,0.8,1.0,1.1,0.5,0.6,0.1,0.0,0.0,0.0,0.0,0.0,0.0],\"wind_speed_10m\":[8.5,9.7,10.6,"
+    "12.4,13.3,11.2,12.0,13.9,12.8,14.4,14.4,15.6,17.1,15.9,17.3,16.2,15.1,15.9,16.4,17.2,17.4,17.3,15.6,14.5,15."
+    "2,14.6,15.0,12.6,14.3,13.3,11.3,10.7,12.2,10.0,11.3,8.6,9.0,9.6,10.9,13.1,13.9,13.4,13.2,14.2,14.4,14.3,15.5"
+    ",16.3,16.0,17.2,17.7,15.4,17.5,16.6,16.8,17.3,15.4,15.5,15.3,16.3,14.5,14.1,13.9,12.5,13.9,12.6,12.8,10.1,9."
+    "1,8.8,11.3,9.6,12.7,12.9,12.0,11.6,13.1,15.6,13.9,13.9,14.6,16.3,15.7,17.1,16.2,15.3,15.1,15.9,15.7,16.2,15."
+    "9,15.9,16.6,14.8,15.6,15.5,13.2,13.3,13.1,12.0,11.8,10.5,9.1,10.0,10.8,9.3,12.0,12.5,13.1,13.3,12.1,14.4,14."
+    "3,14.0,14.3,15.1,16.2,15.3,14.8,17.0,16.4,15.6,16.3,15.7,16.5,14.9,16.4,14.0,14.5,15.7,13.1,13.1,12.8,13.7,1"
+    "2.2,12.5,11.6,10.7,8.5,10.7,10.0,10.2,11.0,11.4,11.8,14.7,14.1,13.8,15.3,14.6,16.7,16.5,14.6,17.4,15.4,17.2,"
+    "15.1,15.8,15.2,15.3,17.3,14.9,13.9,14.2,13.1,13.1,12.7,12.2],\"wind_gusts_10m\":[16.9,15.9,17.4,20.8,25.9,23"
+    ".7,21.4,27.6,20.9,25.8,29.9,29.9,28.6,25.8,30.9,34.1,30.5,29.1,27.9,28.9,28.7,36.2,28.3,24.7,29.7,26.6,28.6,"
+    "27.0,26.2,21.8,20.4,17.8,24.0,18.2,21.2,15.5,19.5,18.4,19.8,23.6,29.0,24.3,23.2,30.7,24.9,28.2,30.9,35.0,27."
+    "3,37.5,36.0,33.0,38.3,27.9,32.2,36.3,26.9,26.0,29.8,31.0,24.8,28.7,28.8,25.8,25.9,23.6,25.8,19.6,15.2,14.5,1"
+    "9.1,20.4,23.4,21.9,20.6,22.4,25.9,32.3,22.6,25.8,24.7,27.0,25.8,28.2,29.2,29.3,26.0,30.2,25.3,35.0,30.2,32.0"
+    ",33.6,24.2,27.4,32.9,23.4,23.4,22.9,19.2,20.3,17.4,16.2,20.5,19.8,18.9,25.6,21.0,27.5,23.1,25.4,27.3,27.5,23"
+    ".0,29.2,28.5,32.2,31.3,24.2,34.1,30.8,34.1,34.1,27.1,27.8,31.2,28.5,22.4,24.4,25.1,28.2,23.9,23.8,24.3,20.9,"
+    "24.7,18.9,19.0,16.0,23.4,19.3,17.6,23.6,19.6,20.6,30.1,25.7,30.1,32.4,26.9,35.5,35.3,26.8,38.0,29.5,34.2,31."
+    "2,26.5,25.0,30.0,34.4,32.4,26.4,28.4,23.6,27.2,27.7,21.1],\"cloud_cover_low\":[37,57,51,62,73,76,97,88,86,10"
+    "0,100,100,97,100,100,100,92,87,65,63,62,67,61,34,28,31,26,25,9,0,0,0,0,0,0,0,5,22,2,9,32,15,41,57,41,69,73,7"
+    "9,85,79,77,100,100,83,100,91,100,100,100,92,72,84,65,70,67,57,61,55,33,34,29,31,11,5,0,0,0,14,8,14,17,0,25,2"
+    "8,24,21,30,33,57,45,74,85,81,71,77,97,94,100,100,96,99,94,87,96,82,86,80,71,66,42,51,27,40,21,36,22,0,1,0,0,"
+    "0,13,14,15,5,8,24,17,18,37,42,40,43,70,60,83,84,69,83,85,92,100,100,87,92,95,90,80,78,80,62,69,76,49,55,50,2"
+    "7,21,23,2,23,13,9,14,0,7,0,9]}}";
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <FS.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+
+class FakeSpiffs {
+ public:
+  bool begin(bool) { return true; }
+  bool exists(const char* path) const { return files.count(path) > 0; }
+
+  File open(const char* path, const char* mode) {
+    if (strcmp(mode, "w") == 0) {
+      files[path] = std::make_shared<std::vector<uint8_t>>();
+    }
+    auto file = files.find(path);
+    return file == files.end() ? File() : File(file->second);
+  }
+
+  bool remove(const char* path) { return files.erase(path) > 0; }
+
+  bool rename(const char* from, const char* to) {
+    auto file = files.find(from);
+    if (file == files.end()) {
+      return false;
+    }
+    files[to] = file->second;
+    files.erase(from);
+    return true;
+  }
+
+ private:
+  std::map<std::string, std::shared_ptr<std::vector<uint8_t>>> files;
+};
+
+inline FakeSpiffs SPIFFS;
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string.h>
+
+#include "WeatherForecast.h"
+
+inline WeatherForecast hourlyForecastFixture(int64_t localDayStart, int currentHour, int currentMinute) {
+  WeatherForecast forecast;
+  memset(&forecast, 0, sizeof(forecast));
+  forecast.currentLocalTime = localDayStart + currentHour * 3600 + currentMinute * 60;
+  forecast.currentConditionsLocalTime = forecast.currentLocalTime;
+  forecast.hourlyStartLocalTime = localDayStart;
+  forecast.hourlyStepSeconds = 3600;
+  forecast.hourlyPointCount = WeatherForecast::MAX_HOURLY_POINTS;
+  forecast.currentTemperatureTenthsCelsius = 150;
+  for (int i = 0; i < WeatherForecast::MAX_HOURLY_POINTS; i++) {
+    forecast.hourlyTemperatureTenthsCelsius[i] = 150;
+    forecast.hourlyWindSpeedTenthsMps[i] = 30;
+    forecast.hourlyWindGustsTenthsMps[i] = 60;
+  }
+  return forecast;
+}
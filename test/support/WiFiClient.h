@@ -0,0 +1,49 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "FakeEventStreamServer.h"
+
+class WiFiClient : public Stream {
+ public:
+  virtual ~WiFiClient() {}
+
+  int connect(const char* host, uint16_t port, int32_t timeoutMillis) {
+    FakeEventStreamServer& server = fakeEventStreamServer();
+    server.connectedHost = host;
+    server.connectedPort = port;
+    server.connectTimeoutMillis = timeoutMillis;
+    if (!server.acceptsConnections || server.connectMillis > (uint32_t)timeoutMillis) {
+      delay(timeoutMillis);
+      return 0;
+    }
+    delay(server.connectMillis);
+    return 1;
+  }
+
+  uint8_t connected() {
+    FakeEventStreamServer& server = fakeEventStreamServer();
+    return server.isStreaming && server.bytesRead < server.totalBytes();
+  }
+
+  int available() override {
+    FakeEventStreamServer& server = fakeEventStreamServer();
+    return server.isStreaming ? (int)(server.arrivedBytes() - server.bytesRead) : 0;
+  }
+
+  int read() override {
+    if (available() <= 0) {
+      return -1;
+    }
+    FakeEventStreamServer& server = fakeEventStreamServer();
+    return server.byteAt(server.bytesRead++);
+  }
+
+  void stop() {
+    FakeEventStreamServer& server = fakeEventStreamServer();
+    if (server.isStreaming && server.bytesRead < server.totalBytes()) {
+      server.wasClosedBeforeEnd = true;
+    }
+    server.isStreaming = false;
+  }
+};
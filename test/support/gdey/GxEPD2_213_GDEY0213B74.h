@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stdint.h>
+
+class GxEPD2_213_GDEY0213B74 {
+ public:
+  static const int16_t WIDTH = 122;
+  static const int16_t HEIGHT = 250;
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+typedef int esp_err_t;
+typedef uint32_t nvs_handle_t;
+
+enum {
+  ESP_OK = 0,
+  ESP_ERR_NVS_NOT_FOUND = 0x1102,
+  ESP_ERR_NVS_INVALID_LENGTH = 0x110c,
+  ESP_ERR_NVS_NO_FREE_PAGES = 0x110d,
+  ESP_ERR_NVS_NEW_VERSION_FOUND = 0x1110,
+};
+
+enum nvs_open_mode_t { NVS_READONLY, NVS_READWRITE };
+
+using FakeNvsStore = std::map<std::string, std::vector<uint8_t>>;
+
+inline FakeNvsStore& fakeNvsStore() {
+  static FakeNvsStore store;
+  return store;
+}
+
+inline int& fakeNvsWriteCount() {
+  static int writeCount = 0;
+  return writeCount;
+}
+
+inline const char* esp_err_to_name(esp_err_t err) { return err == ESP_OK ? "ESP_OK" : "ESP_ERR"; }
+
+inline esp_err_t nvs_open(const char*, nvs_open_mode_t mode, nvs_handle_t* handle) {
+  *handle = 1;
+  return mode == NVS_READONLY && fakeNvsStore().empty() ? ESP_ERR_NVS_NOT_FOUND : ESP_OK;
+}
+
+inline void nvs_close(nvs_handle_t) {}
+
+inline esp_err_t nvs_commit(nvs_handle_t) { return ESP_OK; }
+
+inline esp_err_t fakeNvsGet(const char* key, void* value, size_t* length) {
+  FakeNvsStore::iterator entry = fakeNvsStore().find(key);
+  if (entry == fakeNvsStore().end()) {
+    return ESP_ERR_NVS_NOT_FOUND;
+  }
+  if (value == nullptr) {
+    *length = entry->second.size();
+    return ESP_OK;
+  }
+  if (*length < entry->second.size()) {
+    return ESP_ERR_NVS_INVALID_LENGTH;
+  }
+  memcpy(value, entry->second.data(), entry->second.size());
+  *length = entry->second.size();
+  return ESP_OK;
+}
+
+inline esp_err_t fakeNvsSet(const char* key, const void* value, size_t length) {
+  fakeNvsWriteCount()++;
+  const uint8_t* bytes = static_cast<const uint8_t*>(value);
+  fakeNvsStore()[key].assign(bytes, bytes + length);
+  return ESP_OK;
+}
+
+inline esp_err_t nvs_get_str(nvs_handle_t, const char* key, char* value, size_t* length) {
+  return fakeNvsGet(key, value, length);
+}
+
+inline esp_err_t nvs_set_str(nvs_handle_t, const char* key, const char* value) {
+  return fakeNvsSet(key, value, strlen(value) + 1);
+}
+
+inline esp_err_t nvs_get_blob(nvs_handle_t, const char* key, void* value, size_t* length) {
+  return fakeNvsGet(key, value, length);
+}
+
+inline esp_err_t nvs_set_blob(nvs_handle_t, const char* key, const void* value, size_t length) {
+  return fakeNvsSet(key, value, length);
+}
+
+inline esp_err_t nvs_get_u8(nvs_handle_t, const char* key, uint8_t* value) {
+  size_t length = sizeof(*value);
+  return fakeNvsGet(key, value, &length);
+}
+
+inline esp_err_t nvs_set_u8(nvs_handle_t, const char* key, uint8_t value) {
+  return fakeNvsSet(key, &value, sizeof(value));
+}
+
+inline esp_err_t nvs_get_u16(nvs_handle_t, const char* key, uint16_t* value) {
+  size_t length = sizeof(*value);
+  return fakeNvsGet(key, value, &length);
+}
+
+inline esp_err_t nvs_set_u16(nvs_handle_t, const char* key, uint16_t value) {
+  return fakeNvsSet(key, &value, sizeof(value));
+}
+
+inline esp_err_t nvs_get_u32(nvs_handle_t, const char* key, uint32_t* value) {
+  size_t length = sizeof(*value);
+  return fakeNvsGet(key, value, &length);
+}
+
+inline esp_err_t nvs_set_u32(nvs_handle_t, const char* key, uint32_t value) {
+  return fakeNvsSet(key, &value, sizeof(value));
+}
+
+inline esp_err_t nvs_erase_key(nvs_handle_t, const char* key) {
+  fakeNvsStore().erase(key);
+  return ESP_OK;
+}
+
+inline esp_err_t nvs_erase_all(nvs_handle_t) {
+  fakeNvsStore().clear();
+  return ESP_OK;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <vector>
+
+typedef enum {
+  JDR_OK = 0,
+  JDR_INTR,
+  JDR_INP,
+  JDR_MEM1,
+  JDR_MEM2,
+  JDR_PAR,
+  JDR_FMT1,
+  JDR_FMT2,
+  JDR_FMT3,
+} JRESULT;
+
+typedef struct {
+  uint16_t left;
+  uint16_t right;
+  uint16_t top;
+  uint16_t bottom;
+} JRECT;
+
+typedef struct JDEC JDEC;
+struct JDEC {
+  unsigned int width;
+  unsigned int height;
+  uint8_t scale;
+  unsigned int (*infunc)(JDEC*, uint8_t*, unsigned int);
+  void* device;
+};
+
+static const uint8_t FAKE_JPEG_SIGNATURE[] = {'F', 'J'};
+static const unsigned int FAKE_JPEG_HEADER_SIZE = 6;
+static const unsigned int FAKE_JPEG_MCU_SIZE = 16;
+
+inline JRESULT jd_prepare(JDEC* jd, unsigned int (*infunc)(JDEC*, uint8_t*, unsigned int), void* pool,
+                          unsigned int sz_pool, void* dev) {
+  if (pool == nullptr || sz_pool < 3100) {
+    return JDR_MEM1;
+  }
+
+  jd->infunc = infunc;
+  jd->device = dev;
+  uint8_t header[FAKE_JPEG_HEADER_SIZE];
+  if (infunc(jd, header, sizeof(header)) != sizeof(header)) {
+    return JDR_INP;
+  }
+  if (header[0] != FAKE_JPEG_SIGNATURE[0] || header[1] != FAKE_JPEG_SIGNATURE[1]) {
+    return JDR_FMT1;
+  }
+  jd->width = header[2] | (header[3] << 8);
+  jd->height = header[4] | (header[5] << 8);
+  return JDR_OK;
+}
+
+inline JRESULT jd_decomp(JDEC* jd, unsigned int (*outfunc)(JDEC*, void*, JRECT*), uint8_t scale) {
+  if (scale > 3) {
+    return JDR_PAR;
+  }
+  jd->scale = scale;
+
+  std::vector<uint8_t> band(jd->width * FAKE_JPEG_MCU_SIZE * 3);
+  std::vector<uint8_t> block(FAKE_JPEG_MCU_SIZE * FAKE_JPEG_MCU_SIZE * 3);
+  for (unsigned int y = 0; y < jd->height; y += FAKE_JPEG_MCU_SIZE) {
+    unsigned int bandRows = y + FAKE_JPEG_MCU_SIZE <= jd->height ? FAKE_JPEG_MCU_SIZE : jd->height - y;
+    unsigned int bandBytes = jd->width * bandRows * 3;
+    if (jd->infunc(jd, band.data(), bandBytes) != bandBytes) {
+      return JDR_INP;
+    }
+
+    for (unsigned int x = 0; x < jd->width; x += FAKE_JPEG_MCU_SIZE) {
+      unsigned int columns = x + FAKE_JPEG_MCU_SIZE <= jd->width ? FAKE_JPEG_MCU_SIZE : jd->width - x;
+      unsigned int scaledColumns = columns >> scale;
+      unsigned int scaledRows = bandRows >> scale;
+      if (scaledColumns == 0 || scaledRows == 0) {
+        continue;
+      }
+
+      unsigned int span = 1u << scale;
+      for (unsigned int blockY = 0; blockY < scaledRows; blockY++) {
+        for (unsigned int blockX = 0; blockX < scaledColumns; blockX++) {
+          for (int channel = 0; channel < 3; channel++) {
+            unsigned int sum = 0;
+            for (unsigned int dy = 0; dy < span; dy++) {
+              for (unsigned int dx = 0; dx < span; dx++) {
+                sum += band[((blockY * span + dy) * jd->width + x + blockX * span + dx) * 3 + channel];
+              }
+            }
+            block[(blockY * scaledColumns + blockX) * 3 + channel] = sum / (span * span);
+          }
+        }
+      }
+
+      JRECT rect = {(uint16_t)(x >> scale), (uint16_t)((x >> scale) + scaledColumns - 1), (uint16_t)(y >> scale),
+                    (uint16_t)((y >> scale) + scaledRows - 1)};
+      if (!outfunc(jd, block.data(), &rect)) {
+        return JDR_INTR;
+      }
+    }
+  }
+  return JDR_OK;
+}
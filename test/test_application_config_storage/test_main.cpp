@@ -0,0 +1,179 @@
+#include <nvs.h>
+#include <stddef.h>
+#include <string.h>
+#include <unity.h>
+
+#include "ApplicationConfigStorage.h"
+
+struct SchemaV1Layout {
+  char wifiSSID[64];
+  char wifiPassword[64];
+  char openaiApiKey[200];
+  char aiPromptStyle[200];
+  char city[100];
+  char countryCode[3];
+  char imageUrl[300];
+  float latitude;
+  float longitude;
+  int currentScreenIndex;
+  char llmBaseUrl[128];
+  char llmModel[64];
+  uint16_t llmTimeoutSeconds;
+};
+
+static SchemaV1Layout storedSchemaV1Config() {
+  SchemaV1Layout stored;
+  memset(&stored, 0, sizeof(stored));
+  strcpy(stored.wifiSSID, "home");
+  strcpy(stored.city, "Oslo");
+  strcpy(stored.countryCode, "NO");
+  stored.latitude = 59.91f;
+  stored.longitude = 10.75f;
+  stored.currentScreenIndex = METEOGRAM_SCREEN;
+  strcpy(stored.llmBaseUrl, "http://192.168.1.20:8080/v1");
+  strcpy(stored.llmModel, "llama3");
+  stored.llmTimeoutSeconds = 12;
+  return stored;
+}
+
+static void storeSchemaV1Blob(const SchemaV1Layout& stored, size_t blobSize) {
+  const uint8_t* blob = reinterpret_cast<const uint8_t*>(&stored);
+  fakeNvsStore()["app_config"].assign(blob, blob + blobSize);
+}
+
+void setUp() {
+  ApplicationConfigStorage().clear();
+  fakeNvsStore().clear();
+  fakeNvsWriteCount() = 0;
+}
+
+void tearDown() {}
+
+void test_full_schema_v1_blob_migrates_every_setting() {
+  SchemaV1Layout stored = storedSchemaV1Config();
+  ApplicationConfig config;
+  DeviceState deviceState;
+  TEST_ASSERT_TRUE(ApplicationConfigStorage::migrateSchemaV1Blob(reinterpret_cast<const uint8_t*>(&stored),
+                                                                 sizeof(stored), config, deviceState));
+
+  TEST_ASSERT_EQUAL_STRING("home", config.wifiSSID);
+  TEST_ASSERT_EQUAL_STRING("Oslo", config.city);
+  TEST_ASSERT_EQUAL_STRING("NO", config.countryCode);
+  TEST_ASSERT_EQUAL_STRING("http://192.168.1.20:8080/v1", config.llmBaseUrl);
+  TEST_ASSERT_EQUAL_STRING("llama3", config.llmModel);
+  TEST_ASSERT_EQUAL_UINT16(12, config.llmTimeoutSeconds);
+  TEST_ASSERT_EQUAL_INT(METEOGRAM_SCREEN, deviceState.currentScreenIndex());
+  TEST_ASSERT_EQUAL_FLOAT(59.91f, deviceState.latitude());
+}
+
+void test_schema_v1_blob_without_llm_endpoint_keeps_the_defaults() {
+  SchemaV1Layout stored = storedSchemaV1Config();
+  ApplicationConfig config;
+  DeviceState deviceState;
+  TEST_ASSERT_TRUE(ApplicationConfigStorage::migrateSchemaV1Blob(
+      reinterpret_cast<const uint8_t*>(&stored), offsetof(SchemaV1Layout, llmBaseUrl), config, deviceState));
+
+  TEST_ASSERT_EQUAL_STRING("Oslo", config.city);
+  TEST_ASSERT_EQUAL_STRING(DEFAULT_LLM_BASE_URL, config.llmBaseUrl);
+  TEST_ASSERT_EQUAL_STRING(DEFAULT_LLM_MODEL, config.llmModel);
+  TEST_ASSERT_EQUAL_UINT16(DEFAULT_LLM_TIMEOUT_SECONDS, config.llmTimeoutSeconds);
+}
+
+void test_schema_v1_blob_of_unknown_size_is_rejected() {
+  uint8_t blob[10] = {};
+  ApplicationConfig config;
+  DeviceState deviceState;
+  TEST_ASSERT_FALSE(ApplicationConfigStorage::migrateSchemaV1Blob(blob, sizeof(blob), config, deviceState));
+}
+
+void test_load_migrates_the_stored_blob_and_removes_it() {
+  storeSchemaV1Blob(storedSchemaV1Config(), sizeof(SchemaV1Layout));
+
+  std::unique_ptr<ApplicationConfig> config = ApplicationConfigStorage().load();
+  TEST_ASSERT_NOT_NULL(config.get());
+  TEST_ASSERT_EQUAL_STRING("Oslo", config->city);
+  TEST_ASSERT_EQUAL_INT(0, (int)fakeNvsStore().count("app_config"));
+
+  DeviceState deviceState;
+  deviceState.clearCoordinates();
+  TEST_ASSERT_TRUE(ApplicationConfigStorage().loadCoordinates(deviceState));
+  TEST_ASSERT_EQUAL_FLOAT(59.91f, deviceState.latitude());
+  TEST_ASSERT_EQUAL_FLOAT(10.75f, deviceState.longitude());
+}
+
+void test_coordinates_survive_a_cold_boot_until_cleared() {
+  ApplicationConfigStorage storage;
+  DeviceState deviceState;
+  deviceState.clearCoordinates();
+  TEST_ASSERT_FALSE(storage.loadCoordinates(deviceState));
+  TEST_ASSERT_FALSE(deviceState.hasCoordinates());
+
+  TEST_ASSERT_TRUE(storage.saveCoordinates(59.91f, 10.75f));
+  fakeNvsWriteCount() = 0;
+  TEST_ASSERT_TRUE(storage.saveCoordinates(59.91f, 10.75f));
+  TEST_ASSERT_EQUAL_INT(0, fakeNvsWriteCount());
+
+  TEST_ASSERT_TRUE(storage.loadCoordinates(deviceState));
+  TEST_ASSERT_EQUAL_FLOAT(59.91f, deviceState.latitude());
+  TEST_ASSERT_EQUAL_FLOAT(10.75f, deviceState.longitude());
+
+  storage.clearCoordinates();
+  deviceState.clearCoordinates();
+  TEST_ASSERT_FALSE(storage.loadCoordinates(deviceState));
+  TEST_ASSERT_FALSE(deviceState.hasCoordinates());
+}
+
+void test_saving_unchanged_settings_writes_nothing() {
+  ApplicationConfigStorage storage;
+  ApplicationConfig config;
+  strcpy(config.city, "Oslo");
+  TEST_ASSERT_TRUE(storage.save(config));
+
+  fakeNvsWriteCount() = 0;
+  TEST_ASSERT_TRUE(storage.save(config));
+  TEST_ASSERT_EQUAL_INT(0, fakeNvsWriteCount());
+
+  strcpy(config.city, "Bergen");
+  TEST_ASSERT_TRUE(storage.save(config));
+  TEST_ASSERT_EQUAL_INT(2, fakeNvsWriteCount());
+}
+
+void test_mirror_checksum_detects_corruption() {
+  ApplicationConfig config;
+  strcpy(config.city, "Oslo");
+  ApplicationConfigMirror mirror;
+  ApplicationConfigStorage::storeMirror(mirror, config, 7);
+  TEST_ASSERT_TRUE(ApplicationConfigStorage::isMirrorValid(mirror));
+
+  mirror.config[offsetof(ApplicationConfig, city)] ^= 0x20;
+  TEST_ASSERT_FALSE(ApplicationConfigStorage::isMirrorValid(mirror));
+
+  ApplicationConfigStorage::storeMirror(mirror, config, 7);
+  mirror.generation++;
+  TEST_ASSERT_FALSE(ApplicationConfigStorage::isMirrorValid(mirror));
+}
+
+void test_load_prefers_the_rtc_mirror_over_nvs() {
+  ApplicationConfigStorage storage;
+  ApplicationConfig config;
+  strcpy(config.city, "Oslo");
+  TEST_ASSERT_TRUE(storage.save(config));
+
+  fakeNvsStore().clear();
+  std::unique_ptr<ApplicationConfig> loaded = storage.load();
+  TEST_ASSERT_NOT_NULL(loaded.get());
+  TEST_ASSERT_EQUAL_STRING("Oslo", loaded->city);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_full_schema_v1_blob_migrates_every_setting);
+  RUN_TEST(test_schema_v1_blob_without_llm_endpoint_keeps_the_defaults);
+  RUN_TEST(test_schema_v1_blob_of_unknown_size_is_rejected);
+  RUN_TEST(test_load_migrates_the_stored_blob_and_removes_it);
+  RUN_TEST(test_coordinates_survive_a_cold_boot_until_cleared);
+  RUN_TEST(test_saving_unchanged_settings_writes_nothing);
+  RUN_TEST(test_mirror_checksum_detects_corruption);
+  RUN_TEST(test_load_prefers_the_rtc_mirror_over_nvs);
+  return UNITY_END();
+}
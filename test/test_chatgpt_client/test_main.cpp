@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <unity.h>
+
+#include <string>
+#include <vector>
+
+#include "ChatGPTClient.h"
+#include "FakeEventStreamServer.h"
+
+static const char* SELF_HOSTED_BASE_URL = "http://192.168.1.20:8080/";
+static const uint32_t TIMEOUT_MILLIS = 5000;
+
+static std::string contentEvent(const char* content) {
+  std::string escaped;
+  for (const char* c = content; *c != '\0'; c++) {
+    if (*c == '"' || *c == '\\') {
+      escaped += '\\';
+    }
+    escaped += *c;
+  }
+  return "data: {\"id\":\"chatcmpl-1\",\"choices\":[{\"index\":0,\"delta\":{\"content\":\"" + escaped + "\"}}]}\n\n";
+}
+
+static std::vector<std::string> recordedSentenceEvents() {
+  return {": keep-alive\n\n", contentEvent("Grey skies"), contentEvent(" with light rain."),
+          contentEvent(" Drier later."), "data: [DONE]\n\n"};
+}
+
+void setUp() {
+  resetFakeEventStreamServer();
+  fakeMillis() = 0;
+}
+
+void tearDown() {}
+
+void test_recorded_event_stream_is_assembled_into_the_completion() {
+  fakeEventStreamServer().serveEvents(recordedSentenceEvents(), 40);
+  ChatGPTClient client("sk-test", SELF_HOSTED_BASE_URL, "llama3", TIMEOUT_MILLIS);
+
+  String completion = client.generateContent("Describe the weather");
+
+  TEST_ASSERT_EQUAL_STRING("Grey skies with light rain. Drier later.", completion.c_str());
+  const FakeEventStreamServer& server = fakeEventStreamServer();
+  TEST_ASSERT_EQUAL_STRING("192.168.1.20", server.connectedHost.c_str());
+  TEST_ASSERT_EQUAL_UINT16(8080, server.connectedPort);
+  TEST_ASSERT_EQUAL_STRING("http://192.168.1.20:8080/v1/chat/completions", server.requestUrl.c_str());
+  TEST_ASSERT_EQUAL_STRING("text/event-stream", server.requestHeaders.at("Accept").c_str());
+  TEST_ASSERT_EQUAL_STRING("Bearer sk-test", server.requestHeaders.at("Authorization").c_str());
+  TEST_ASSERT_TRUE(server.requestPayload.find("\"stream\":true") != std::string::npos);
+  TEST_ASSERT_FALSE(server.wasClosedBeforeEnd);
+}
+
+void test_unreachable_server_gives_up_at_the_deadline() {
+  fakeEventStreamServer().acceptsConnections = false;
+  ChatGPTClient client("", SELF_HOSTED_BASE_URL, "llama3", TIMEOUT_MILLIS);
+
+  String completion = client.generateContent("Describe the weather");
+
+  TEST_ASSERT_TRUE(completion.startsWith("Error:"));
+  TEST_ASSERT_EQUAL_UINT32(TIMEOUT_MILLIS, fakeEventStreamServer().connectTimeoutMillis);
+  TEST_ASSERT_EQUAL_UINT32(TIMEOUT_MILLIS, millis());
+  TEST_ASSERT_TRUE(fakeEventStreamServer().requestPayload.empty());
+}
+
+void test_slow_stream_is_cut_off_at_the_deadline_and_closed() {
+  fakeEventStreamServer().serveEvents(recordedSentenceEvents(), 2000);
+  ChatGPTClient client("", SELF_HOSTED_BASE_URL, "llama3", TIMEOUT_MILLIS);
+
+  String completion = client.generateContent("Describe the weather");
+
+  TEST_ASSERT_EQUAL_STRING("Grey skies with light rain.", completion.c_str());
+  TEST_ASSERT_UINT32_WITHIN(10, TIMEOUT_MILLIS, millis());
+  TEST_ASSERT_TRUE(fakeEventStreamServer().wasClosedBeforeEnd);
+}
+
+void test_error_status_returns_no_completion() {
+  fakeEventStreamServer().responseCode = 401;
+  fakeEventStreamServer().errorBody = "{\"error\":\"invalid api key\"}";
+  ChatGPTClient client("sk-wrong", SELF_HOSTED_BASE_URL, "llama3", TIMEOUT_MILLIS);
+
+  std::vector<String> summaries;
+  TEST_ASSERT_FALSE(client.generateSummaries("Summaries", 2, 160, summaries));
+  TEST_ASSERT_TRUE(summaries.empty());
+}
+
+void test_summary_stream_is_closed_once_the_array_is_complete() {
+  fakeEventStreamServer().serveEvents({contentEvent("[\"Rain at 15h."), contentEvent("\", \"Dry [mostly] tonight.\"]"),
+                                       contentEvent(" Let me know if you need more!"), "data: [DONE]\n\n"},
+                                      1500);
+  ChatGPTClient client("", SELF_HOSTED_BASE_URL, "llama3", TIMEOUT_MILLIS);
+
+  std::vector<String> summaries;
+  TEST_ASSERT_TRUE(client.generateSummaries("Summaries", 2, 160, summaries));
+
+  TEST_ASSERT_EQUAL_size_t(2, summaries.size());
+  TEST_ASSERT_EQUAL_STRING("Rain at 15h.", summaries[0].c_str());
+  TEST_ASSERT_EQUAL_STRING("Dry [mostly] tonight.", summaries[1].c_str());
+  TEST_ASSERT_TRUE(fakeEventStreamServer().wasClosedBeforeEnd);
+  TEST_ASSERT_LESS_THAN(3000, millis());
+}
+
+void test_eight_long_summaries_outgrow_the_default_buffer_and_still_fit() {
+  std::string summary(195, 'x');
+  std::string array = "[";
+  for (int i = 0; i < 8; i++) {
+    array += (i > 0 ? ", \"" : "\"") + summary + "\"";
+  }
+  array += "]";
+  TEST_ASSERT_GREATER_THAN(SseTokenParser::DEFAULT_MAX_CONTENT_LENGTH, array.size());
+  std::vector<std::string> events;
+  for (size_t offset = 0; offset < array.size(); offset += 40) {
+    events.push_back(contentEvent(array.substr(offset, 40).c_str()));
+  }
+  events.push_back("data: [DONE]\n\n");
+  fakeEventStreamServer().serveEvents(events, 10);
+  ChatGPTClient client("", SELF_HOSTED_BASE_URL, "llama3", TIMEOUT_MILLIS);
+
+  std::vector<String> summaries;
+  TEST_ASSERT_TRUE(client.generateSummaries("Summaries", 8, 160, summaries));
+  TEST_ASSERT_EQUAL_size_t(8, summaries.size());
+  TEST_ASSERT_EQUAL_STRING(summary.c_str(), summaries[7].c_str());
+  printf("Eight-slot summary stream: %u bytes of content parsed in %lu ms of simulated streaming\n",
+         (unsigned)array.size(), (unsigned long)millis());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_recorded_event_stream_is_assembled_into_the_completion);
+  RUN_TEST(test_unreachable_server_gives_up_at_the_deadline);
+  RUN_TEST(test_slow_stream_is_cut_off_at_the_deadline_and_closed);
+  RUN_TEST(test_error_status_returns_no_completion);
+  RUN_TEST(test_summary_stream_is_closed_once_the_array_is_complete);
+  RUN_TEST(test_eight_long_summaries_outgrow_the_default_buffer_and_still_fit);
+  return UNITY_END();
+}
@@ -0,0 +1,96 @@
+#include <math.h>
+#include <unity.h>
+
+#include "ForecastCache.h"
+#include "WeatherForecastFixture.h"
+
+static const int64_t JUNE_FIRST_2024 = 1717200000;
+static const int64_t FETCHED_AT_UTC = JUNE_FIRST_2024 + 8 * 3600;
+static const float LATITUDE = 59.91f;
+static const float LONGITUDE = 10.75f;
+static const uint32_t MAX_AGE_SECONDS = 3 * 3600;
+
+static ForecastCacheEntry freshEntry() {
+  ForecastCacheEntry entry;
+  entry.forecast = hourlyForecastFixture(JUNE_FIRST_2024, 10, 0);
+  entry.fetchedAt = FETCHED_AT_UTC;
+  entry.latitude = LATITUDE;
+  entry.longitude = LONGITUDE;
+  entry.hasForecast = true;
+  return entry;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_entry_is_fresh_right_after_the_fetch() {
+  TEST_ASSERT_TRUE(ForecastCache::isEntryFresh(freshEntry(), LATITUDE, LONGITUDE, FETCHED_AT_UTC, MAX_AGE_SECONDS));
+}
+
+void test_entry_goes_stale_after_the_max_age() {
+  ForecastCacheEntry entry = freshEntry();
+  TEST_ASSERT_TRUE(
+      ForecastCache::isEntryFresh(entry, LATITUDE, LONGITUDE, FETCHED_AT_UTC + MAX_AGE_SECONDS, MAX_AGE_SECONDS));
+  TEST_ASSERT_FALSE(
+      ForecastCache::isEntryFresh(entry, LATITUDE, LONGITUDE, FETCHED_AT_UTC + MAX_AGE_SECONDS + 1, MAX_AGE_SECONDS));
+}
+
+void test_entry_is_stale_when_the_clock_went_backwards() {
+  TEST_ASSERT_FALSE(
+      ForecastCache::isEntryFresh(freshEntry(), LATITUDE, LONGITUDE, FETCHED_AT_UTC - 1, MAX_AGE_SECONDS));
+}
+
+void test_entry_is_stale_once_now_passes_the_last_hourly_point() {
+  ForecastCacheEntry entry = freshEntry();
+  entry.forecast.hourlyPointCount = 12;
+  int64_t lastHourAgeSeconds = 11 * 3600 - (entry.forecast.currentLocalTime - JUNE_FIRST_2024);
+  TEST_ASSERT_TRUE(ForecastCache::isEntryFresh(entry, LATITUDE, LONGITUDE, FETCHED_AT_UTC + lastHourAgeSeconds,
+                                               24 * 3600));
+  TEST_ASSERT_FALSE(ForecastCache::isEntryFresh(entry, LATITUDE, LONGITUDE, FETCHED_AT_UTC + lastHourAgeSeconds + 1,
+                                                24 * 3600));
+
+  entry.forecast.hourlyPointCount = 0;
+  TEST_ASSERT_FALSE(ForecastCache::isEntryFresh(entry, LATITUDE, LONGITUDE, FETCHED_AT_UTC, MAX_AGE_SECONDS));
+}
+
+void test_entry_only_matches_its_own_location() {
+  ForecastCacheEntry entry = freshEntry();
+  TEST_ASSERT_TRUE(ForecastCache::isEntryForLocation(entry, LATITUDE + 0.0005f, LONGITUDE - 0.0005f));
+  TEST_ASSERT_FALSE(ForecastCache::isEntryForLocation(entry, LATITUDE + 0.01f, LONGITUDE));
+  TEST_ASSERT_FALSE(ForecastCache::isEntryForLocation(entry, NAN, NAN));
+
+  entry.hasForecast = false;
+  TEST_ASSERT_FALSE(ForecastCache::isEntryForLocation(entry, LATITUDE, LONGITUDE));
+}
+
+void test_advance_to_now_moves_the_current_time_forward() {
+  ForecastCacheEntry entry = freshEntry();
+  WeatherForecast advanced = ForecastCache::advanceToNow(entry, FETCHED_AT_UTC + 1800);
+  TEST_ASSERT_EQUAL_INT64(entry.forecast.currentLocalTime + 1800, advanced.currentLocalTime);
+  TEST_ASSERT_EQUAL_INT64(entry.forecast.hourlyStartLocalTime, advanced.hourlyStartLocalTime);
+
+  advanced = ForecastCache::advanceToNow(entry, FETCHED_AT_UTC - 600);
+  TEST_ASSERT_EQUAL_INT64(entry.forecast.currentLocalTime, advanced.currentLocalTime);
+}
+
+void test_cache_round_trips_through_rtc_memory() {
+  ForecastCache cache;
+  ForecastCacheEntry entry = freshEntry();
+  cache.store(entry.forecast, LATITUDE, LONGITUDE, FETCHED_AT_UTC);
+  TEST_ASSERT_TRUE(cache.hasForecastFor(LATITUDE, LONGITUDE));
+  TEST_ASSERT_TRUE(cache.isFresh(LATITUDE, LONGITUDE, FETCHED_AT_UTC + 600, MAX_AGE_SECONDS));
+  TEST_ASSERT_EQUAL_INT64(entry.forecast.currentLocalTime + 600, cache.load(FETCHED_AT_UTC + 600).currentLocalTime);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_entry_is_fresh_right_after_the_fetch);
+  RUN_TEST(test_entry_goes_stale_after_the_max_age);
+  RUN_TEST(test_entry_is_stale_when_the_clock_went_backwards);
+  RUN_TEST(test_entry_is_stale_once_now_passes_the_last_hourly_point);
+  RUN_TEST(test_entry_only_matches_its_own_location);
+  RUN_TEST(test_advance_to_now_moves_the_current_time_forward);
+  RUN_TEST(test_cache_round_trips_through_rtc_memory);
+  return UNITY_END();
+}
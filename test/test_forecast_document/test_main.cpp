@@ -0,0 +1,109 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "ForecastDocument.h"
+#include "MemoryStream.h"
+#include "OpenMeteoResponses.h"
+
+static const int64_t JUNE_FIRST_2024 = 1717200000;
+static const size_t BENCHMARK_CAPACITY = 32768;
+
+static std::vector<uint8_t> responseBytes(const char* response) {
+  return std::vector<uint8_t>(response, response + strlen(response));
+}
+
+static double elapsedMicros(const timespec& start, const timespec& end) {
+  return (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_one_day_response_fills_the_forecast() {
+  MemoryStream stream(responseBytes(OPEN_METEO_OSLO_ONE_DAY_RESPONSE));
+  ForecastDocument document;
+  TEST_ASSERT_FALSE(document.parse(stream));
+
+  WeatherForecast forecast = {};
+  document.fill(forecast);
+  TEST_ASSERT_EQUAL_INT16(174, forecast.currentTemperatureTenthsCelsius);
+  TEST_ASSERT_EQUAL_UINT8(3, forecast.currentWeatherCode);
+  TEST_ASSERT_EQUAL_UINT16(38, forecast.currentWindSpeedTenthsMps);
+  TEST_ASSERT_EQUAL_UINT16(82, forecast.currentWindGustsTenthsMps);
+  TEST_ASSERT_EQUAL_UINT16(214, forecast.currentWindDirectionDegrees);
+  TEST_ASSERT_EQUAL_INT32(7200, forecast.utcOffsetSeconds);
+  TEST_ASSERT_EQUAL_INT64(JUNE_FIRST_2024 + 13 * 3600 + 15 * 60, forecast.currentLocalTime);
+  TEST_ASSERT_EQUAL_INT64(JUNE_FIRST_2024, forecast.hourlyStartLocalTime);
+  TEST_ASSERT_EQUAL_UINT16(3600, forecast.hourlyStepSeconds);
+  TEST_ASSERT_EQUAL_UINT8(WeatherForecast::MAX_HOURLY_POINTS, forecast.hourlyPointCount);
+  TEST_ASSERT_EQUAL_INT16(89, forecast.hourlyTemperatureTenthsCelsius[0]);
+  TEST_ASSERT_EQUAL_INT16(190, forecast.hourlyTemperatureTenthsCelsius[12]);
+  TEST_ASSERT_EQUAL_INT16(111, forecast.hourlyTemperatureTenthsCelsius[23]);
+}
+
+void test_longer_responses_keep_the_first_day() {
+  MemoryStream stream(responseBytes(OPEN_METEO_OSLO_SEVEN_DAY_RESPONSE));
+  ForecastDocument document(BENCHMARK_CAPACITY);
+  TEST_ASSERT_FALSE(document.parse(stream));
+
+  WeatherForecast forecast = {};
+  document.fill(forecast);
+  TEST_ASSERT_EQUAL_UINT8(WeatherForecast::MAX_HOURLY_POINTS, forecast.hourlyPointCount);
+  TEST_ASSERT_EQUAL_INT64(JUNE_FIRST_2024, forecast.hourlyStartLocalTime);
+  TEST_ASSERT_EQUAL_INT16(93, forecast.hourlyTemperatureTenthsCelsius[0]);
+  TEST_ASSERT_EQUAL_INT16(121, forecast.hourlyTemperatureTenthsCelsius[23]);
+}
+
+void test_truncated_response_reports_an_error() {
+  std::vector<uint8_t> truncated = responseBytes(OPEN_METEO_OSLO_ONE_DAY_RESPONSE);
+  truncated.resize(truncated.size() / 2);
+  MemoryStream stream(truncated);
+  ForecastDocument document;
+  TEST_ASSERT_TRUE(document.parse(stream));
+}
+
+void test_filtered_document_benchmark_against_recorded_responses() {
+  const char* responses[] = {OPEN_METEO_OSLO_ONE_DAY_RESPONSE, OPEN_METEO_OSLO_THREE_DAY_RESPONSE,
+                             OPEN_METEO_OSLO_SEVEN_DAY_RESPONSE};
+  const int days[] = {1, 3, 7};
+  const int repetitions = 50;
+
+  for (int r = 0; r < 3; r++) {
+    std::vector<uint8_t> response = responseBytes(responses[r]);
+    DynamicJsonDocument unfilteredDocument(BENCHMARK_CAPACITY * 2);
+    TEST_ASSERT_FALSE(deserializeJson(unfilteredDocument, responses[r]));
+
+    ForecastDocument document(BENCHMARK_CAPACITY);
+    timespec start;
+    timespec end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < repetitions; i++) {
+      MemoryStream stream(response);
+      TEST_ASSERT_FALSE(document.parse(stream));
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    size_t bufferedPeak = response.size() + unfilteredDocument.memoryUsage();
+    printf("Forecast %d day: %u bytes raw, buffered peak %u bytes, streamed peak %u bytes, parse %.0f us\n", days[r],
+           (unsigned)response.size(), (unsigned)bufferedPeak, (unsigned)document.memoryUsage(),
+           elapsedMicros(start, end) / repetitions);
+    TEST_ASSERT_LESS_THAN(unfilteredDocument.memoryUsage(), document.memoryUsage());
+    if (days[r] == 1) {
+      TEST_ASSERT_LESS_THAN(ForecastDocument::DEFAULT_CAPACITY, document.memoryUsage());
+    }
+  }
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_one_day_response_fills_the_forecast);
+  RUN_TEST(test_longer_responses_keep_the_first_day);
+  RUN_TEST(test_truncated_response_reports_an_error);
+  RUN_TEST(test_filtered_document_benchmark_against_recorded_responses);
+  return UNITY_END();
+}
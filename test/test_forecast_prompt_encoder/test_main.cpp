@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include "ForecastDocument.h"
+#include "ForecastPromptEncoder.h"
+#include "OpenMeteoResponses.h"
+#include "WeatherForecastFixture.h"
+
+static const int64_t JUNE_FIRST_2024 = 1717200000;
+
+static char encoded[ForecastPromptEncoder::MAX_ENCODED_LENGTH];
+
+static WeatherForecast forecastFromRecordedResponse(const char* response) {
+  WeatherForecast forecast = {};
+  ForecastDocument document;
+  if (!document.parse(response)) {
+    document.fill(forecast);
+  }
+  return forecast;
+}
+
+void setUp() { memset(encoded, 0, sizeof(encoded)); }
+
+void tearDown() {}
+
+void test_encodes_current_conditions_and_remaining_hours() {
+  WeatherForecast forecast = hourlyForecastFixture(JUNE_FIRST_2024, 21, 30);
+  forecast.currentTemperatureTenthsCelsius = -25;
+  forecast.currentWindSpeedTenthsMps = 34;
+  forecast.currentWindGustsTenthsMps = 71;
+  forecast.hourlyTemperatureTenthsCelsius[22] = -5;
+  forecast.hourlyPrecipitationTenthsMm[23] = 12;
+  forecast.hourlyCloudCoveragePercent[23] = 85;
+
+  size_t length = ForecastPromptEncoder::encode(forecast, encoded, sizeof(encoded));
+  TEST_ASSERT_EQUAL_STRING(
+      "Now 21:30: -2.5C, Clear, wind 3.4 gusts 7.1 m/s\n"
+      "hour|temp C|rain mm|wind m/s|gust m/s|cloud %\n"
+      "21|15.0|0.0|3.0|6.0|0\n"
+      "22|-0.5|0.0|3.0|6.0|0\n"
+      "23|15.0|1.2|3.0|6.0|85\n",
+      encoded);
+  TEST_ASSERT_EQUAL_size_t(strlen(encoded), length);
+}
+
+void test_encoding_is_truncated_to_the_buffer() {
+  WeatherForecast forecast = hourlyForecastFixture(JUNE_FIRST_2024, 0, 0);
+  char shortBuffer[32];
+  size_t length = ForecastPromptEncoder::encode(forecast, shortBuffer, sizeof(shortBuffer));
+  TEST_ASSERT_EQUAL_size_t(sizeof(shortBuffer) - 1, length);
+  TEST_ASSERT_EQUAL_size_t(length, strlen(shortBuffer));
+}
+
+void test_recorded_forecast_is_much_smaller_than_the_raw_response() {
+  WeatherForecast forecast = forecastFromRecordedResponse(OPEN_METEO_OSLO_ONE_DAY_RESPONSE);
+  TEST_ASSERT_TRUE(forecast.isValid());
+
+  size_t rawLength = strlen(OPEN_METEO_OSLO_ONE_DAY_RESPONSE);
+  size_t encodedLength = ForecastPromptEncoder::encode(forecast, encoded, sizeof(encoded));
+  printf("Prompt forecast payload: %u bytes raw Open-Meteo JSON, %u bytes encoded\n", (unsigned)rawLength,
+         (unsigned)encodedLength);
+
+  TEST_ASSERT_LESS_THAN(ForecastPromptEncoder::MAX_ENCODED_LENGTH - 1, encodedLength);
+  TEST_ASSERT_LESS_THAN(rawLength / 2, encodedLength);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_encodes_current_conditions_and_remaining_hours);
+  RUN_TEST(test_encoding_is_truncated_to_the_buffer);
+  RUN_TEST(test_recorded_forecast_is_much_smaller_than_the_raw_response);
+  return UNITY_END();
+}
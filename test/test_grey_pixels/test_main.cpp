@@ -0,0 +1,167 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "GreyDitherer.h"
+#include "GreyPixelPacker.h"
+
+static const uint8_t EXACT_GREY_LUMINANCES[] = {0x00, 0x55, 0xAA, 0xFF};
+
+static GreyPixelPacker exactGreyPacker() {
+  GreyPixelPacker packer;
+  for (int i = 0; i < 256; i++) {
+    packer.setPaletteEntry(i, EXACT_GREY_LUMINANCES[i % 4]);
+  }
+  return packer;
+}
+
+static void packRowPixelByPixel(const uint8_t* indexedRow, uint32_t width, uint8_t* packedRow) {
+  memset(packedRow, 0, (width + 3) / 4);
+  for (uint32_t x = 0; x < width; x++) {
+    uint32_t byteIndex = x / 4;
+    uint8_t bitShift = 6 - (x % 4) * 2;
+    packedRow[byteIndex] |= (indexedRow[x] & 0x03) << bitShift;
+  }
+}
+
+static double elapsedMicros(const timespec& start, const timespec& end) {
+  return (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_nearest_level_covers_the_luminance_range() {
+  TEST_ASSERT_EQUAL_UINT8(0, GreyDitherer::nearestLevel(-40));
+  TEST_ASSERT_EQUAL_UINT8(0, GreyDitherer::nearestLevel(42));
+  TEST_ASSERT_EQUAL_UINT8(1, GreyDitherer::nearestLevel(43));
+  TEST_ASSERT_EQUAL_UINT8(2, GreyDitherer::nearestLevel(170));
+  TEST_ASSERT_EQUAL_UINT8(3, GreyDitherer::nearestLevel(300));
+  for (uint8_t level = 0; level < GreyDitherer::GREY_LEVELS; level++) {
+    TEST_ASSERT_EQUAL_UINT8(level, GreyDitherer::nearestLevel(GreyDitherer::levelLuminance(level)));
+  }
+}
+
+void test_dither_keeps_flat_grey_levels_exact() {
+  const uint16_t width = 13;
+  GreyDitherer ditherer(width);
+  uint8_t luminanceRow[width];
+  uint8_t packedRow[(width + 3) / 4];
+  memset(luminanceRow, 0xAA, sizeof(luminanceRow));
+
+  for (int row = 0; row < 4; row++) {
+    ditherer.ditherRow(luminanceRow, packedRow);
+    TEST_ASSERT_EQUAL_HEX8(0xAA, packedRow[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xAA, packedRow[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x80, packedRow[3]);
+  }
+}
+
+void test_dither_preserves_average_luminance() {
+  const uint16_t width = 64;
+  const int rows = 64;
+  GreyDitherer ditherer(width);
+  uint8_t luminanceRow[width];
+  uint8_t packedRow[width / 4];
+  memset(luminanceRow, 0x80, sizeof(luminanceRow));
+
+  long luminanceSum = 0;
+  for (int row = 0; row < rows; row++) {
+    ditherer.ditherRow(luminanceRow, packedRow);
+    for (int x = 0; x < width; x++) {
+      luminanceSum += GreyDitherer::levelLuminance((packedRow[x / 4] >> (6 - (x % 4) * 2)) & 0x03);
+    }
+  }
+  TEST_ASSERT_INT_WITHIN(2, 0x80, luminanceSum / (width * rows));
+}
+
+void test_exact_grey_level_rejects_in_between_luminance() {
+  TEST_ASSERT_EQUAL_UINT8(1, GreyPixelPacker::exactGreyLevel(0x56));
+  TEST_ASSERT_EQUAL_UINT8(GreyPixelPacker::NOT_A_GREY_LEVEL, GreyPixelPacker::exactGreyLevel(0x70));
+}
+
+void test_packer_honors_a_non_identity_palette() {
+  GreyPixelPacker packer;
+  packer.setPaletteEntry(0, 0xFF);
+  packer.setPaletteEntry(1, 0xAA);
+  packer.setPaletteEntry(2, 0x55);
+  packer.setPaletteEntry(3, 0x00);
+  TEST_ASSERT_TRUE(packer.isExactGreyPalette());
+
+  const uint8_t indexedRow[] = {0, 1, 2, 3, 3, 2, 1, 0};
+  uint8_t packedRow[2];
+  packer.packRow(indexedRow, sizeof(indexedRow), packedRow);
+  TEST_ASSERT_EQUAL_HEX8(0xE4, packedRow[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x1B, packedRow[1]);
+
+  packer.setPaletteEntry(4, 0x70);
+  TEST_ASSERT_FALSE(packer.isExactGreyPalette());
+}
+
+void test_packer_handles_odd_widths() {
+  GreyPixelPacker packer = exactGreyPacker();
+  const uint8_t indexedRow[] = {3, 2, 1, 0, 3, 2, 1, 0, 0, 0, 0, 0};
+
+  for (uint32_t width = 1; width <= 8; width++) {
+    uint8_t packedRow[3] = {0xEE, 0xEE, 0xEE};
+    uint8_t expectedRow[3] = {0xEE, 0xEE, 0xEE};
+    packer.packRow(indexedRow, width, packedRow);
+    packRowPixelByPixel(indexedRow, width, expectedRow);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expectedRow, packedRow, (width + 3) / 4);
+    TEST_ASSERT_EQUAL_HEX8(0xEE, packedRow[2]);
+  }
+}
+
+void test_packer_benchmark_against_the_pixel_by_pixel_loop() {
+  const uint32_t width = 250;
+  const uint32_t paddedWidth = (width + 3) & ~3u;
+  const int rows = 122;
+  const int repetitions = 200;
+
+  std::vector<uint8_t> image(paddedWidth * rows);
+  for (size_t i = 0; i < image.size(); i++) {
+    image[i] = (i * 7 + i / paddedWidth) % 4;
+  }
+  std::vector<uint8_t> tablePacked((width + 3) / 4 * rows);
+  std::vector<uint8_t> loopPacked(tablePacked.size());
+  GreyPixelPacker packer = exactGreyPacker();
+
+  timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int repetition = 0; repetition < repetitions; repetition++) {
+    for (int row = 0; row < rows; row++) {
+      packRowPixelByPixel(&image[row * paddedWidth], width, &loopPacked[row * ((width + 3) / 4)]);
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double loopMicros = elapsedMicros(start, end);
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (int repetition = 0; repetition < repetitions; repetition++) {
+    for (int row = 0; row < rows; row++) {
+      packer.packRow(&image[row * paddedWidth], width, &tablePacked[row * ((width + 3) / 4)]);
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double tableMicros = elapsedMicros(start, end);
+
+  printf("Packing %ux%d x%d: pixel loop %.0f us, table packer %.0f us\n", width, rows, repetitions, loopMicros,
+         tableMicros);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(loopPacked.data(), tablePacked.data(), tablePacked.size());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_nearest_level_covers_the_luminance_range);
+  RUN_TEST(test_dither_keeps_flat_grey_levels_exact);
+  RUN_TEST(test_dither_preserves_average_luminance);
+  RUN_TEST(test_exact_grey_level_rejects_in_between_luminance);
+  RUN_TEST(test_packer_honors_a_non_identity_palette);
+  RUN_TEST(test_packer_handles_odd_widths);
+  RUN_TEST(test_packer_benchmark_against_the_pixel_by_pixel_loop);
+  return UNITY_END();
+}
@@ -0,0 +1,324 @@
+#include <MemoryStream.h>
+#include <rom/crc.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "BmpStreamDecoder.h"
+#include "ImageCache.h"
+#include "JpegStreamDecoder.h"
+#include "PackedImageDecoder.h"
+
+static void appendUint16(std::vector<uint8_t>& data, uint16_t value) {
+  data.push_back(value & 0xff);
+  data.push_back(value >> 8);
+}
+
+static void appendUint32(std::vector<uint8_t>& data, uint32_t value) {
+  appendUint16(data, value & 0xffff);
+  appendUint16(data, value >> 16);
+}
+
+static std::vector<uint8_t> gradientPixels(uint32_t width, uint32_t height) {
+  std::vector<uint8_t> rgbPixels;
+  for (uint32_t y = 0; y < height; y++) {
+    for (uint32_t x = 0; x < width; x++) {
+      rgbPixels.push_back(x * 255 / (width - 1));
+      rgbPixels.push_back(y * 255 / (height - 1));
+      rgbPixels.push_back((x * 37 + y * 11) % 256);
+    }
+  }
+  return rgbPixels;
+}
+
+static std::vector<uint8_t> bmpFile(uint32_t width, uint32_t height, bool isTopDown, uint16_t bitsPerPixel,
+                                    const std::vector<uint8_t>& topDownPixels,
+                                    const std::vector<uint8_t>& paletteLuminance = {}) {
+  uint32_t bytesPerPixel = bitsPerPixel / 8;
+  uint32_t rowSize = ((width * bitsPerPixel + 31) / 32) * 4;
+  uint32_t dataOffset = 54 + paletteLuminance.size() * 4;
+
+  std::vector<uint8_t> file = {'B', 'M'};
+  appendUint32(file, dataOffset + rowSize * height);
+  appendUint32(file, 0);
+  appendUint32(file, dataOffset);
+  appendUint32(file, 40);
+  appendUint32(file, width);
+  appendUint32(file, isTopDown ? (uint32_t)-(int32_t)height : height);
+  appendUint16(file, 1);
+  appendUint16(file, bitsPerPixel);
+  appendUint32(file, 0);
+  appendUint32(file, rowSize * height);
+  appendUint32(file, 2835);
+  appendUint32(file, 2835);
+  appendUint32(file, paletteLuminance.size());
+  appendUint32(file, 0);
+
+  for (uint8_t luminance : paletteLuminance) {
+    file.insert(file.end(), {luminance, luminance, luminance, 0});
+  }
+
+  for (uint32_t row = 0; row < height; row++) {
+    uint32_t y = isTopDown ? row : height - 1 - row;
+    const uint8_t* source = &topDownPixels[y * width * bytesPerPixel];
+    for (uint32_t x = 0; x < width; x++) {
+      if (bitsPerPixel == 8) {
+        file.push_back(source[x]);
+      } else {
+        file.insert(file.end(), {source[x * 3 + 2], source[x * 3 + 1], source[x * 3]});
+      }
+    }
+    file.insert(file.end(), rowSize - width * bytesPerPixel, 0);
+  }
+  return file;
+}
+
+static std::vector<uint8_t> fakeJpegFile(uint16_t width, uint16_t height, const std::vector<uint8_t>& rgbPixels) {
+  std::vector<uint8_t> file(FAKE_JPEG_SIGNATURE, FAKE_JPEG_SIGNATURE + sizeof(FAKE_JPEG_SIGNATURE));
+  appendUint16(file, width);
+  appendUint16(file, height);
+  file.insert(file.end(), rgbPixels.begin(), rgbPixels.end());
+  return file;
+}
+
+static std::vector<uint8_t> packBits(const std::vector<uint8_t>& row) {
+  std::vector<uint8_t> encoded;
+  size_t i = 0;
+  while (i < row.size()) {
+    size_t run = 1;
+    while (i + run < row.size() && run < 128 && row[i + run] == row[i]) {
+      run++;
+    }
+    if (run > 1) {
+      encoded.push_back(257 - run);
+      encoded.push_back(row[i]);
+      i += run;
+      continue;
+    }
+
+    size_t literalStart = i;
+    while (i < row.size() && i - literalStart < 128 && (i + 1 >= row.size() || row[i + 1] != row[i])) {
+      i++;
+    }
+    encoded.push_back(i - literalStart - 1);
+    encoded.insert(encoded.end(), row.begin() + literalStart, row.begin() + i);
+  }
+  return encoded;
+}
+
+static std::vector<std::vector<uint8_t>> drawnRowsInDisplayOrder(const DisplayType& display, int16_t height) {
+  std::vector<std::vector<uint8_t>> rows(height);
+  for (const DrawnGreyRow& drawn : display.drawnRows) {
+    TEST_ASSERT_TRUE(drawn.y >= 0 && drawn.y < height);
+    TEST_ASSERT_TRUE(rows[drawn.y].empty());
+    rows[drawn.y] = drawn.packedRow;
+  }
+  return rows;
+}
+
+static uint32_t rowsChecksum(const std::vector<std::vector<uint8_t>>& rows) {
+  uint32_t checksum = 0;
+  for (const std::vector<uint8_t>& row : rows) {
+    checksum = crc32_le(checksum, row.data(), row.size());
+  }
+  return checksum;
+}
+
+static std::vector<std::vector<uint8_t>> decodeToRows(ImageDecoder& decoder, int16_t targetWidth,
+                                                      int16_t targetHeight, DisplayType& display) {
+  TEST_ASSERT_TRUE(decoder.readHeader());
+  ImageLayout layout = decoder.layoutFor(targetWidth, targetHeight);
+  layout.x = 0;
+  layout.y = 0;
+  TEST_ASSERT_TRUE(decoder.draw(layout, nullptr));
+  return drawnRowsInDisplayOrder(display, layout.height);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_exact_grey_bmp_is_packed_without_dithering() {
+  const std::vector<uint8_t> indices = {0, 1, 2, 3, 3, 2, 1, 0, 3, 3, 0, 0, 1, 1, 2, 2};
+  std::vector<uint8_t> file = bmpFile(8, 2, false, 8, indices, {0xFF, 0xAA, 0x55, 0x00});
+  MemoryStream stream(file);
+  DisplayType display;
+  BmpStreamDecoder decoder(stream, display);
+
+  std::vector<std::vector<uint8_t>> rows = decodeToRows(decoder, 8, 2, display);
+  const uint8_t expectedFirstRow[] = {0xE4, 0x1B};
+  const uint8_t expectedSecondRow[] = {0x0F, 0xA5};
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expectedFirstRow, rows[0].data(), 2);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(expectedSecondRow, rows[1].data(), 2);
+}
+
+void test_24_bit_bmp_matches_the_golden_rows() {
+  std::vector<uint8_t> file = bmpFile(6, 3, false, 24, gradientPixels(6, 3));
+  MemoryStream stream(file);
+  DisplayType display;
+  BmpStreamDecoder decoder(stream, display);
+
+  std::vector<std::vector<uint8_t>> rows = decodeToRows(decoder, 6, 3, display);
+  const uint8_t expectedRows[3][2] = {{0x05, 0x50}, {0x55, 0xA0}, {0xAB, 0xF0}};
+  for (int y = 0; y < 3; y++) {
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expectedRows[y], rows[y].data(), 2);
+  }
+}
+
+void test_scaled_bmp_matches_the_golden_checksum() {
+  std::vector<uint8_t> file = bmpFile(64, 48, false, 24, gradientPixels(64, 48));
+  MemoryStream stream(file);
+  DisplayType display;
+  BmpStreamDecoder decoder(stream, display);
+
+  std::vector<std::vector<uint8_t>> rows = decodeToRows(decoder, 30, 30, display);
+  TEST_ASSERT_EQUAL_size_t(22, rows.size());
+  TEST_ASSERT_EQUAL_HEX32(0x30E3D3DD, rowsChecksum(rows));
+}
+
+void test_jpeg_matches_a_top_down_bmp_with_the_same_pixels() {
+  const uint16_t width = 40;
+  const uint16_t height = 20;
+  std::vector<uint8_t> pixels = gradientPixels(width, height);
+
+  std::vector<uint8_t> bmp = bmpFile(width, height, true, 24, pixels);
+  std::vector<uint8_t> jpeg = fakeJpegFile(width, height, pixels);
+
+  const int16_t targetSizes[][2] = {{40, 20}, {30, 30}};
+  for (const int16_t* target : targetSizes) {
+    MemoryStream bmpStream(bmp);
+    DisplayType bmpDisplay;
+    BmpStreamDecoder bmpDecoder(bmpStream, bmpDisplay);
+    std::vector<std::vector<uint8_t>> bmpRows = decodeToRows(bmpDecoder, target[0], target[1], bmpDisplay);
+
+    MemoryStream jpegStream(jpeg);
+    DisplayType jpegDisplay;
+    JpegStreamDecoder jpegDecoder(jpegStream, jpegDisplay);
+    std::vector<std::vector<uint8_t>> jpegRows = decodeToRows(jpegDecoder, target[0], target[1], jpegDisplay);
+
+    TEST_ASSERT_EQUAL_size_t(bmpRows.size(), jpegRows.size());
+    TEST_ASSERT_EQUAL_HEX32(rowsChecksum(bmpRows), rowsChecksum(jpegRows));
+  }
+}
+
+void test_jpeg_is_decoded_at_a_reduced_scale_and_fills_every_row() {
+  TEST_ASSERT_EQUAL_UINT8(0, JpegStreamDecoder::decodeScaleFor(250, 122, 250, 122));
+  TEST_ASSERT_EQUAL_UINT8(1, JpegStreamDecoder::decodeScaleFor(640, 480, 162, 122));
+  TEST_ASSERT_EQUAL_UINT8(3, JpegStreamDecoder::decodeScaleFor(4000, 3000, 162, 122));
+
+  const uint16_t width = 500;
+  const uint16_t height = 250;
+  std::vector<uint8_t> jpeg = fakeJpegFile(width, height, gradientPixels(width, height));
+  MemoryStream stream(jpeg);
+  DisplayType display;
+  JpegStreamDecoder decoder(stream, display);
+  TEST_ASSERT_TRUE(decoder.readHeader());
+
+  ImageLayout layout = decoder.layoutFor(250, 122);
+  TEST_ASSERT_EQUAL_INT16(244, layout.width);
+  TEST_ASSERT_EQUAL_INT16(122, layout.height);
+  TEST_ASSERT_TRUE(decoder.draw(layout, nullptr));
+
+  TEST_ASSERT_EQUAL_size_t(layout.height, display.drawnRows.size());
+  for (int16_t y = 0; y < layout.height; y++) {
+    TEST_ASSERT_EQUAL_INT16(layout.x, display.drawnRows[y].x);
+    TEST_ASSERT_EQUAL_INT16(layout.y + y, display.drawnRows[y].y);
+  }
+}
+
+void test_cached_image_replays_the_decoded_rows() {
+  const char* etag = "\"golden\"";
+  const uint16_t width = 48;
+  const uint16_t height = 36;
+  std::vector<uint8_t> files[] = {bmpFile(width, height, false, 24, gradientPixels(width, height)),
+                                  fakeJpegFile(width, height, gradientPixels(width, height))};
+
+  for (const std::vector<uint8_t>& file : files) {
+    MemoryStream stream(file);
+    DisplayType display;
+    std::unique_ptr<ImageDecoder> decoder =
+        ImageDecoder::create(file[0] == 'B' ? "image/bmp" : "image/jpeg", stream, display);
+    TEST_ASSERT_TRUE(decoder->readHeader());
+    ImageLayout layout = decoder->layoutFor(250, 122);
+
+    ImageCache cache;
+    TEST_ASSERT_TRUE(cache.beginWrite(etag, layout));
+    TEST_ASSERT_TRUE(cache.finishWrite(decoder->draw(layout, &cache)));
+    TEST_ASSERT_TRUE(cache.contains(etag));
+    TEST_ASSERT_FALSE(cache.contains("\"stale\""));
+
+    DisplayType replayDisplay;
+    TEST_ASSERT_TRUE(cache.draw(replayDisplay, etag));
+    TEST_ASSERT_EQUAL_size_t(display.drawnRows.size(), replayDisplay.drawnRows.size());
+    for (size_t row = 0; row < display.drawnRows.size(); row++) {
+      const DrawnGreyRow& drawn = display.drawnRows[row];
+      const DrawnGreyRow& replayed = replayDisplay.drawnRows[row];
+      TEST_ASSERT_EQUAL_INT16(drawn.y, replayed.y);
+      TEST_ASSERT_EQUAL_HEX8_ARRAY(drawn.packedRow.data(), replayed.packedRow.data(), drawn.packedRow.size());
+    }
+  }
+}
+
+void test_truncated_jpeg_reports_failure() {
+  std::vector<uint8_t> jpeg = fakeJpegFile(32, 32, gradientPixels(32, 32));
+  jpeg.resize(jpeg.size() / 2);
+  MemoryStream stream(jpeg);
+  DisplayType display;
+  JpegStreamDecoder decoder(stream, display);
+  TEST_ASSERT_TRUE(decoder.readHeader());
+  TEST_ASSERT_FALSE(decoder.draw(decoder.layoutFor(32, 32), nullptr));
+}
+
+void test_packbits_image_round_trips() {
+  const uint16_t width = 37;
+  const uint16_t height = 5;
+  size_t rowBytes = (width + 3) / 4;
+  std::vector<std::vector<uint8_t>> rows;
+  std::vector<uint8_t> file = {'G', '2', 'P', 'K'};
+  appendUint16(file, width);
+  appendUint16(file, height);
+  file.insert(file.end(), {1, PackedImageDecoder::PACKBITS_ROWS, 0, 0});
+  for (uint16_t y = 0; y < height; y++) {
+    std::vector<uint8_t> row(rowBytes, 0xFF);
+    for (size_t i = y * 2; i < rowBytes; i += 3) {
+      row[i] = (uint8_t)(i * 29 + y);
+    }
+    rows.push_back(row);
+    std::vector<uint8_t> encoded = packBits(row);
+    file.insert(file.end(), encoded.begin(), encoded.end());
+  }
+
+  MemoryStream stream(file);
+  DisplayType display;
+  PackedImageDecoder decoder(stream, display);
+  std::vector<std::vector<uint8_t>> decodedRows = decodeToRows(decoder, 250, 122, display);
+  TEST_ASSERT_EQUAL_size_t(height, decodedRows.size());
+  for (uint16_t y = 0; y < height; y++) {
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(rows[y].data(), decodedRows[y].data(), rowBytes);
+  }
+}
+
+void test_decoder_is_chosen_by_content_type() {
+  std::vector<uint8_t> jpeg = fakeJpegFile(8, 8, gradientPixels(8, 8));
+  MemoryStream stream(jpeg);
+  DisplayType display;
+
+  std::unique_ptr<ImageDecoder> decoder = ImageDecoder::create("image/JPEG", stream, display);
+  TEST_ASSERT_NOT_NULL(decoder.get());
+  TEST_ASSERT_TRUE(decoder->readHeader());
+  TEST_ASSERT_NULL(ImageDecoder::create("image/png", stream, display).get());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_exact_grey_bmp_is_packed_without_dithering);
+  RUN_TEST(test_24_bit_bmp_matches_the_golden_rows);
+  RUN_TEST(test_scaled_bmp_matches_the_golden_checksum);
+  RUN_TEST(test_jpeg_matches_a_top_down_bmp_with_the_same_pixels);
+  RUN_TEST(test_jpeg_is_decoded_at_a_reduced_scale_and_fills_every_row);
+  RUN_TEST(test_cached_image_replays_the_decoded_rows);
+  RUN_TEST(test_truncated_jpeg_reports_failure);
+  RUN_TEST(test_packbits_image_round_trips);
+  RUN_TEST(test_decoder_is_chosen_by_content_type);
+  return UNITY_END();
+}
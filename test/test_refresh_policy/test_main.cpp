@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <unity.h>
+
+#include "RefreshPolicy.h"
+#include "WeatherForecastFixture.h"
+
+static const int64_t JUNE_FIRST_2024 = 1717200000;
+static const uint32_t BASE_INTERVAL_SECONDS = 900;
+
+static int wakesPerDay(float batteryVoltage, const WeatherForecast* forecast) {
+  int wakeCount = 0;
+  for (uint32_t secondOfDay = 0; secondOfDay < 86400;) {
+    RefreshConditions conditions = {batteryVoltage, (int)(secondOfDay / 3600), forecast};
+    secondOfDay += RefreshPolicy::refreshIntervalSeconds(BASE_INTERVAL_SECONDS, conditions);
+    wakeCount++;
+  }
+  return wakeCount;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_battery_discharge_trace_never_shortens_the_interval() {
+  uint32_t previousInterval = 0;
+  for (float voltage = 4.2f; voltage >= 3.3f; voltage -= 0.05f) {
+    RefreshConditions conditions = {voltage, 12, nullptr};
+    uint32_t interval = RefreshPolicy::refreshIntervalSeconds(BASE_INTERVAL_SECONDS, conditions);
+    TEST_ASSERT_GREATER_OR_EQUAL(previousInterval, interval);
+    previousInterval = interval;
+  }
+  TEST_ASSERT_EQUAL_UINT32(3600, previousInterval);
+}
+
+void test_overnight_hours_stretch_the_interval() {
+  TEST_ASSERT_TRUE(RefreshPolicy::isOvernight(23));
+  TEST_ASSERT_TRUE(RefreshPolicy::isOvernight(5));
+  TEST_ASSERT_FALSE(RefreshPolicy::isOvernight(6));
+  TEST_ASSERT_FALSE(RefreshPolicy::isOvernight(-1));
+
+  RefreshConditions conditions = {4.1f, 2, nullptr};
+  TEST_ASSERT_EQUAL_UINT32(3600, RefreshPolicy::refreshIntervalSeconds(BASE_INTERVAL_SECONDS, conditions));
+}
+
+void test_intervals_snap_to_the_schedule() {
+  TEST_ASSERT_EQUAL_UINT32(300, RefreshPolicy::snapToScheduleInterval(10.0f));
+  TEST_ASSERT_EQUAL_UINT32(450, RefreshPolicy::snapToScheduleInterval(450.0f));
+  TEST_ASSERT_EQUAL_UINT32(900, RefreshPolicy::snapToScheduleInterval(1000.0f));
+  TEST_ASSERT_EQUAL_UINT32(1350, RefreshPolicy::snapToScheduleInterval(1200.0f));
+  TEST_ASSERT_EQUAL_UINT32(5400, RefreshPolicy::snapToScheduleInterval(5400.0f));
+  TEST_ASSERT_EQUAL_UINT32(14400, RefreshPolicy::snapToScheduleInterval(100000.0f));
+}
+
+void test_volatile_weather_at_most_doubles_the_refresh_rate() {
+  WeatherForecast forecast = hourlyForecastFixture(JUNE_FIRST_2024, 12, 20);
+  forecast.hourlyWindGustsTenthsMps[13] = 120;
+  RefreshConditions conditions = {4.1f, 12, &forecast};
+  uint32_t interval = RefreshPolicy::refreshIntervalSeconds(BASE_INTERVAL_SECONDS, conditions);
+  TEST_ASSERT_GREATER_OR_EQUAL(BASE_INTERVAL_SECONDS / 2, interval);
+  TEST_ASSERT_LESS_THAN(BASE_INTERVAL_SECONDS, interval);
+}
+
+void test_mid_battery_lengthens_the_interval() {
+  RefreshConditions conditions = {3.8f, 12, nullptr};
+  uint32_t interval = RefreshPolicy::refreshIntervalSeconds(BASE_INTERVAL_SECONDS, conditions);
+  TEST_ASSERT_GREATER_THAN(BASE_INTERVAL_SECONDS, interval);
+  TEST_ASSERT_GREATER_THAN(3600, RefreshPolicy::refreshIntervalSeconds(3600, conditions));
+}
+
+void test_calm_forecast_is_not_volatile() {
+  WeatherForecast forecast = hourlyForecastFixture(JUNE_FIRST_2024, 12, 20);
+  TEST_ASSERT_FALSE(RefreshPolicy::hasVolatileWeatherAhead(forecast));
+}
+
+void test_rain_onset_temperature_swing_and_gusts_are_volatile() {
+  WeatherForecast forecast = hourlyForecastFixture(JUNE_FIRST_2024, 12, 20);
+  forecast.hourlyPrecipitationTenthsMm[14] = 8;
+  TEST_ASSERT_TRUE(RefreshPolicy::hasVolatileWeatherAhead(forecast));
+
+  forecast = hourlyForecastFixture(JUNE_FIRST_2024, 12, 20);
+  forecast.hourlyTemperatureTenthsCelsius[15] = 100;
+  TEST_ASSERT_TRUE(RefreshPolicy::hasVolatileWeatherAhead(forecast));
+
+  forecast = hourlyForecastFixture(JUNE_FIRST_2024, 12, 20);
+  forecast.hourlyWindGustsTenthsMps[13] = 120;
+  TEST_ASSERT_TRUE(RefreshPolicy::hasVolatileWeatherAhead(forecast));
+
+  forecast = hourlyForecastFixture(JUNE_FIRST_2024, 12, 20);
+  forecast.hourlyPrecipitationTenthsMm[16] = 8;
+  TEST_ASSERT_FALSE(RefreshPolicy::hasVolatileWeatherAhead(forecast));
+}
+
+void test_ongoing_rain_is_not_an_onset() {
+  WeatherForecast forecast = hourlyForecastFixture(JUNE_FIRST_2024, 12, 20);
+  for (int hour = 12; hour < 16; hour++) {
+    forecast.hourlyPrecipitationTenthsMm[hour] = 15;
+  }
+  TEST_ASSERT_FALSE(RefreshPolicy::hasVolatileWeatherAhead(forecast));
+}
+
+void test_daily_wake_counts_follow_battery_and_weather() {
+  WeatherForecast calm = hourlyForecastFixture(JUNE_FIRST_2024, 12, 0);
+  WeatherForecast stormy = calm;
+  for (int hour = 0; hour < WeatherForecast::MAX_HOURLY_POINTS; hour++) {
+    stormy.hourlyWindGustsTenthsMps[hour] = hour % 2 == 0 ? 60 : 160;
+  }
+
+  int fullCalm = wakesPerDay(4.1f, &calm);
+  int fullStormy = wakesPerDay(4.1f, &stormy);
+  int lowCalm = wakesPerDay(3.4f, &calm);
+  printf("Wakes per day: full battery calm %d, full battery stormy %d, low battery calm %d\n", fullCalm, fullStormy,
+         lowCalm);
+
+  TEST_ASSERT_EQUAL_INT(6 + 17 * 4 + 1, fullCalm);
+  TEST_ASSERT_GREATER_THAN(fullCalm, fullStormy);
+  TEST_ASSERT_LESS_OR_EQUAL(6 + 17 * 8 + 1, fullStormy);
+  TEST_ASSERT_LESS_THAN(fullCalm, lowCalm);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_battery_discharge_trace_never_shortens_the_interval);
+  RUN_TEST(test_overnight_hours_stretch_the_interval);
+  RUN_TEST(test_intervals_snap_to_the_schedule);
+  RUN_TEST(test_volatile_weather_at_most_doubles_the_refresh_rate);
+  RUN_TEST(test_mid_battery_lengthens_the_interval);
+  RUN_TEST(test_calm_forecast_is_not_volatile);
+  RUN_TEST(test_rain_onset_temperature_swing_and_gusts_are_volatile);
+  RUN_TEST(test_ongoing_rain_is_not_an_onset);
+  RUN_TEST(test_daily_wake_counts_follow_battery_and_weather);
+  return UNITY_END();
+}
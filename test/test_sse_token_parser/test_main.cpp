@@ -0,0 +1,97 @@
+#include <string.h>
+#include <unity.h>
+
+#include "SseTokenParser.h"
+
+static const char RECORDED_STREAM[] =
+    ": keep-alive\n"
+    "\n"
+    "data: {\"id\":\"chatcmpl-1\",\"choices\":[{\"index\":0,\"delta\":{\"role\":\"assistant\",\"content\":\"\"}}]}\n"
+    "\n"
+    "data: {\"id\":\"chatcmpl-1\",\"choices\":[{\"index\":0,\"delta\":{\"content\":\"Grey skies\"}}]}\n"
+    "\n"
+    "data: {\"id\":\"chatcmpl-1\",\"choices\":[{\"index\":0,\"delta\":{\"content\":\" with light rain.\"}}]}\r\n"
+    "\r\n"
+    "data: {\"id\":\"chatcmpl-1\",\"choices\":[{\"index\":0,\"delta\":{\"content\":\" Drier \\\"later\\\".\"}}]}\n"
+    "\n"
+    "data: {\"id\":\"chatcmpl-1\",\"choices\":[{\"index\":0,\"delta\":{},\"finish_reason\":\"stop\"}]}\n"
+    "\n"
+    "data: [DONE]\n"
+    "\n";
+
+static const char RECORDED_SUMMARY_STREAM[] =
+    "data: {\"choices\":[{\"delta\":{\"content\":\"Sure: [\\\"Rain [heavy] \"}}]}\n"
+    "data: {\"choices\":[{\"delta\":{\"content\":\"at 15h.\\\", \\\"Say \\\\\\\"dry]\\\\\\\".\\\"]\"}}]}\n"
+    "data: {\"choices\":[{\"delta\":{\"content\":\" Hope this helps!\"}}]}\n"
+    "data: [DONE]\n";
+
+static void feedInChunks(SseTokenParser& parser, const char* data, size_t chunkLength) {
+  size_t length = strlen(data);
+  for (size_t offset = 0; offset < length; offset += chunkLength) {
+    parser.feed(data + offset, offset + chunkLength < length ? chunkLength : length - offset);
+  }
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_recorded_stream_is_assembled_whatever_the_chunk_size() {
+  const size_t chunkLengths[] = {1, 7, 64, sizeof(RECORDED_STREAM)};
+  for (size_t chunkLength : chunkLengths) {
+    SseTokenParser parser;
+    feedInChunks(parser, RECORDED_STREAM, chunkLength);
+    TEST_ASSERT_TRUE(parser.isComplete());
+    TEST_ASSERT_EQUAL_STRING("Grey skies with light rain. Drier \"later\".", parser.content());
+  }
+}
+
+void test_closing_json_array_stops_the_stream_early() {
+  SseTokenParser parser(SseTokenParser::DEFAULT_MAX_CONTENT_LENGTH, true);
+  feedInChunks(parser, RECORDED_SUMMARY_STREAM, 16);
+  TEST_ASSERT_TRUE(parser.isComplete());
+  TEST_ASSERT_FALSE(parser.isTruncated());
+  TEST_ASSERT_EQUAL_STRING("Sure: [\"Rain [heavy] at 15h.\", \"Say \\\"dry]\\\".\"]", parser.content());
+}
+
+void test_content_beyond_the_capacity_is_reported_truncated() {
+  SseTokenParser parser(12);
+  feedInChunks(parser, RECORDED_STREAM, 7);
+  TEST_ASSERT_TRUE(parser.isComplete());
+  TEST_ASSERT_TRUE(parser.isTruncated());
+  TEST_ASSERT_EQUAL_STRING("Grey skies ", parser.content());
+}
+
+void test_unparsable_events_are_skipped() {
+  SseTokenParser parser;
+  const char stream[] =
+      "data: {not json}\n"
+      "data: {\"choices\":[{\"delta\":{\"content\":\"Sunny.\"}}]}\n";
+  parser.feed(stream, strlen(stream));
+  TEST_ASSERT_FALSE(parser.isComplete());
+  TEST_ASSERT_TRUE(parser.hasContent());
+  TEST_ASSERT_EQUAL_STRING("Sunny.", parser.content());
+}
+
+void test_overlong_lines_are_dropped() {
+  SseTokenParser parser;
+  char line[SseTokenParser::MAX_LINE_LENGTH + 16];
+  memset(line, 'x', sizeof(line) - 1);
+  line[sizeof(line) - 2] = '\n';
+  line[sizeof(line) - 1] = '\0';
+  memcpy(line, "data: ", 6);
+  parser.feed(line, strlen(line));
+  const char next[] = "data: {\"choices\":[{\"delta\":{\"content\":\"Calm.\"}}]}\n";
+  parser.feed(next, strlen(next));
+  TEST_ASSERT_EQUAL_STRING("Calm.", parser.content());
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_recorded_stream_is_assembled_whatever_the_chunk_size);
+  RUN_TEST(test_closing_json_array_stops_the_stream_early);
+  RUN_TEST(test_content_beyond_the_capacity_is_reported_truncated);
+  RUN_TEST(test_unparsable_events_are_skipped);
+  RUN_TEST(test_overlong_lines_are_dropped);
+  return UNITY_END();
+}
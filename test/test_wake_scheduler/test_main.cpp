@@ -0,0 +1,133 @@
+#include <math.h>
+#include <stdio.h>
+#include <unity.h>
+
+#include "WakeScheduler.h"
+
+static const int64_t JUNE_FIRST_2024 = 1717200000;
+static const int32_t OSLO_SUMMER_OFFSET_SECONDS = 7200;
+static const int32_t TRUE_DRIFT_PARTS_PER_MILLION = 20000;
+static const uint32_t REFRESH_INTERVAL_SECONDS = 900;
+static const int WAKES_PER_CLOCK_SYNC = 1;
+
+struct WeekSimulation {
+  int wakeCount;
+  double worstLatenessSeconds;
+  double worstEarlinessSeconds;
+};
+
+static WeekSimulation simulateWeek(bool correctsDrift) {
+  WeekSimulation simulation = {0, 0.0, 0.0};
+  double realTime = JUNE_FIRST_2024 + 1234;
+  double systemTime = realTime;
+  WakeSchedulerState state = {};
+
+  while (realTime < JUNE_FIRST_2024 + 7 * 86400) {
+    if (simulation.wakeCount % WAKES_PER_CLOCK_SYNC == 0) {
+      int64_t serverTimeUtc = (int64_t)realTime;
+      WakeScheduler::recordClockSynchronization(state, (int64_t)systemTime, serverTimeUtc, OSLO_SUMMER_OFFSET_SECONDS);
+      systemTime = serverTimeUtc;
+      realTime = serverTimeUtc;
+    }
+
+    int32_t driftEstimate = correctsDrift ? state.driftPartsPerMillion : 0;
+    int64_t nowUtc = WakeScheduler::correctForDrift((int64_t)systemTime, state.lastSynchronizedUtc, driftEstimate);
+    int64_t plannedWakeUtc = WakeScheduler::nextAlignedWakeUtc(nowUtc, OSLO_SUMMER_OFFSET_SECONDS,
+                                                               REFRESH_INTERVAL_SECONDS);
+    uint32_t sleepSeconds = WakeScheduler::sleepSecondsForClockDrift(plannedWakeUtc - nowUtc, driftEstimate);
+
+    systemTime += sleepSeconds;
+    realTime += sleepSeconds * 1000000.0 / (1000000 + TRUE_DRIFT_PARTS_PER_MILLION);
+    simulation.wakeCount++;
+
+    if (realTime > JUNE_FIRST_2024 + 2 * WakeScheduler::MINIMUM_DRIFT_MEASUREMENT_SECONDS) {
+      double wakeError = realTime - plannedWakeUtc;
+      simulation.worstLatenessSeconds = fmax(simulation.worstLatenessSeconds, wakeError);
+      simulation.worstEarlinessSeconds = fmax(simulation.worstEarlinessSeconds, -wakeError);
+    }
+  }
+  return simulation;
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_correct_for_drift_undoes_a_fast_clock() {
+  int64_t synchronizedAt = JUNE_FIRST_2024;
+  int64_t fastSystemTime = synchronizedAt + 3600 + 72;
+  TEST_ASSERT_EQUAL_INT64(synchronizedAt + 3600, WakeScheduler::correctForDrift(fastSystemTime, synchronizedAt, 20000));
+  TEST_ASSERT_EQUAL_INT64(fastSystemTime, WakeScheduler::correctForDrift(fastSystemTime, synchronizedAt, 0));
+}
+
+void test_measured_drift_is_clamped() {
+  TEST_ASSERT_EQUAL_INT32(20000, WakeScheduler::measureDriftPartsPerMillion(3672, 3600));
+  TEST_ASSERT_EQUAL_INT32(-WakeScheduler::MAXIMUM_DRIFT_PARTS_PER_MILLION,
+                          WakeScheduler::measureDriftPartsPerMillion(0, 3600));
+}
+
+void test_quarter_hour_syncs_still_produce_a_drift_estimate() {
+  WakeSchedulerState state = {};
+  int64_t serverTimeUtc = JUNE_FIRST_2024;
+  WakeScheduler::recordClockSynchronization(state, serverTimeUtc, serverTimeUtc, OSLO_SUMMER_OFFSET_SECONDS);
+
+  for (int sync = 1; sync <= 4; sync++) {
+    TEST_ASSERT_FALSE(state.hasDriftEstimate);
+    int64_t systemTimeAtSync = serverTimeUtc + REFRESH_INTERVAL_SECONDS + 18;
+    serverTimeUtc += REFRESH_INTERVAL_SECONDS;
+    WakeScheduler::recordClockSynchronization(state, systemTimeAtSync, serverTimeUtc, OSLO_SUMMER_OFFSET_SECONDS);
+  }
+
+  TEST_ASSERT_TRUE(state.hasDriftEstimate);
+  TEST_ASSERT_EQUAL_INT32(TRUE_DRIFT_PARTS_PER_MILLION, state.driftPartsPerMillion);
+  TEST_ASSERT_EQUAL_INT64(serverTimeUtc, state.lastSynchronizedUtc);
+}
+
+void test_first_drift_measurement_is_taken_as_is() {
+  TEST_ASSERT_EQUAL_INT32(20000, WakeScheduler::smoothedDriftPartsPerMillion(0, false, 20000));
+  TEST_ASSERT_EQUAL_INT32(15000, WakeScheduler::smoothedDriftPartsPerMillion(10000, true, 20000));
+}
+
+void test_next_wake_lands_after_the_provider_publishes() {
+  int64_t localQuarterHour = JUNE_FIRST_2024 + 10 * 3600 + 15 * 60;
+  int64_t nowUtc = localQuarterHour - OSLO_SUMMER_OFFSET_SECONDS - 300;
+  int64_t expectedWakeUtc =
+      localQuarterHour - OSLO_SUMMER_OFFSET_SECONDS + WakeScheduler::PROVIDER_PUBLISH_DELAY_SECONDS;
+  TEST_ASSERT_EQUAL_INT64(expectedWakeUtc, WakeScheduler::nextAlignedWakeUtc(nowUtc, OSLO_SUMMER_OFFSET_SECONDS, 900));
+
+  nowUtc = expectedWakeUtc - 30;
+  TEST_ASSERT_EQUAL_INT64(expectedWakeUtc + 900,
+                          WakeScheduler::nextAlignedWakeUtc(nowUtc, OSLO_SUMMER_OFFSET_SECONDS, 900));
+}
+
+void test_sleep_never_drops_below_the_minimum() {
+  TEST_ASSERT_EQUAL_UINT32(WakeScheduler::MINIMUM_SLEEP_SECONDS, WakeScheduler::sleepSecondsForClockDrift(5, 0));
+  TEST_ASSERT_EQUAL_UINT32(918, WakeScheduler::sleepSecondsForClockDrift(900, 20000));
+}
+
+void test_week_of_wakes_stays_on_schedule_with_drift_correction() {
+  WeekSimulation corrected = simulateWeek(true);
+  WeekSimulation uncorrected = simulateWeek(false);
+  printf("Week with %ld ppm clock drift: %d wakes, worst %.1f s late and %.1f s early with correction; "
+         "%d wakes, worst %.1f s late and %.1f s early without\n",
+         (long)TRUE_DRIFT_PARTS_PER_MILLION, corrected.wakeCount, corrected.worstLatenessSeconds,
+         corrected.worstEarlinessSeconds, uncorrected.wakeCount, uncorrected.worstLatenessSeconds,
+         uncorrected.worstEarlinessSeconds);
+
+  TEST_ASSERT_INT_WITHIN(2, 7 * 86400 / REFRESH_INTERVAL_SECONDS, corrected.wakeCount);
+  TEST_ASSERT_TRUE(corrected.worstLatenessSeconds < 3.0);
+  TEST_ASSERT_TRUE(corrected.worstEarlinessSeconds < 3.0);
+  TEST_ASSERT_TRUE(uncorrected.worstEarlinessSeconds > 10.0);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_correct_for_drift_undoes_a_fast_clock);
+  RUN_TEST(test_measured_drift_is_clamped);
+  RUN_TEST(test_quarter_hour_syncs_still_produce_a_drift_estimate);
+  RUN_TEST(test_first_drift_measurement_is_taken_as_is);
+  RUN_TEST(test_next_wake_lands_after_the_provider_publishes);
+  RUN_TEST(test_sleep_never_drops_below_the_minimum);
+  RUN_TEST(test_week_of_wakes_stays_on_schedule_with_drift_correction);
+  return UNITY_END();
+}
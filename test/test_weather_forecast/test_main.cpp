@@ -0,0 +1,77 @@
+#include <math.h>
+#include <unity.h>
+
+#include "WeatherForecast.h"
+
+static const int64_t JUNE_FIRST_2024 = 1717200000;
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_signed_tenths_round_trip_within_half_a_tenth() {
+  const float temperatures[] = {-40.0f, -12.34f, -0.05f, 0.0f, 0.04f, 7.25f, 21.96f, 45.5f};
+  for (float temperature : temperatures) {
+    int16_t tenths = WeatherForecast::toSignedTenths(temperature);
+    TEST_ASSERT_FLOAT_WITHIN(0.051f, temperature, tenths / 10.0f);
+  }
+}
+
+void test_signed_tenths_clamp_and_reject_nan() {
+  TEST_ASSERT_EQUAL_INT16(0, WeatherForecast::toSignedTenths(NAN));
+  TEST_ASSERT_EQUAL_INT16(INT16_MAX, WeatherForecast::toSignedTenths(1e6f));
+  TEST_ASSERT_EQUAL_INT16(INT16_MIN, WeatherForecast::toSignedTenths(-1e6f));
+}
+
+void test_unsigned_tenths_round_trip_and_clamp() {
+  const float windSpeeds[] = {0.04f, 0.06f, 3.33f, 12.5f, 48.87f};
+  for (float windSpeed : windSpeeds) {
+    uint16_t tenths = WeatherForecast::toUnsignedTenths(windSpeed);
+    TEST_ASSERT_FLOAT_WITHIN(0.051f, windSpeed, tenths / 10.0f);
+  }
+  TEST_ASSERT_EQUAL_UINT16(0, WeatherForecast::toUnsignedTenths(-2.0f));
+  TEST_ASSERT_EQUAL_UINT16(0, WeatherForecast::toUnsignedTenths(NAN));
+  TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, WeatherForecast::toUnsignedTenths(1e6f));
+}
+
+void test_percent_rounds_and_clamps() {
+  TEST_ASSERT_EQUAL_UINT8(0, WeatherForecast::toPercent(-5.0f));
+  TEST_ASSERT_EQUAL_UINT8(0, WeatherForecast::toPercent(NAN));
+  TEST_ASSERT_EQUAL_UINT8(43, WeatherForecast::toPercent(42.5f));
+  TEST_ASSERT_EQUAL_UINT8(100, WeatherForecast::toPercent(130.0f));
+}
+
+void test_parse_local_time() {
+  TEST_ASSERT_EQUAL_INT64(JUNE_FIRST_2024 + 14 * 3600 + 30 * 60,
+                          WeatherForecast::parseLocalTime("2024-06-01T14:30"));
+  TEST_ASSERT_EQUAL_INT64(951782400, WeatherForecast::parseLocalTime("2000-02-29T00:00"));
+  TEST_ASSERT_EQUAL_INT64(0, WeatherForecast::parseLocalTime("not a timestamp"));
+  TEST_ASSERT_EQUAL_INT64(0, WeatherForecast::parseLocalTime(nullptr));
+}
+
+void test_parse_http_date() {
+  TEST_ASSERT_EQUAL_INT64(JUNE_FIRST_2024 + 8 * 3600 + 5 * 60 + 9,
+                          WeatherForecast::parseHttpDate("Sat, 01 Jun 2024 08:05:09 GMT"));
+  TEST_ASSERT_EQUAL_INT64(0, WeatherForecast::parseHttpDate("Sat, 01 Foo 2024 08:05:09 GMT"));
+  TEST_ASSERT_EQUAL_INT64(0, WeatherForecast::parseHttpDate(nullptr));
+}
+
+void test_format_time_of_day() {
+  char buffer[6];
+  WeatherForecast::formatTimeOfDay(JUNE_FIRST_2024 + 9 * 3600 + 7 * 60, buffer, sizeof(buffer));
+  TEST_ASSERT_EQUAL_STRING("09:07", buffer);
+  WeatherForecast::formatTimeOfDay(-60, buffer, sizeof(buffer));
+  TEST_ASSERT_EQUAL_STRING("23:59", buffer);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_signed_tenths_round_trip_within_half_a_tenth);
+  RUN_TEST(test_signed_tenths_clamp_and_reject_nan);
+  RUN_TEST(test_unsigned_tenths_round_trip_and_clamp);
+  RUN_TEST(test_percent_rounds_and_clamps);
+  RUN_TEST(test_parse_local_time);
+  RUN_TEST(test_parse_http_date);
+  RUN_TEST(test_format_time_of_day);
+  return UNITY_END();
+}
@@ -0,0 +1,87 @@
+#include <string.h>
+#include <unity.h>
+
+#include "WeatherForecastFixture.h"
+#include "WeatherSentenceGenerator.h"
+
+static const int64_t JUNE_FIRST_2024 = 1717200000;
+static const uint8_t LIGHT_RAIN_CODE = 61;
+
+static char sentence[WeatherSentenceGenerator::MAX_SENTENCE_LENGTH];
+
+static WeatherForecast rainyAfternoon() {
+  WeatherForecast forecast = hourlyForecastFixture(JUNE_FIRST_2024, 13, 20);
+  forecast.currentWeatherCode = LIGHT_RAIN_CODE;
+  forecast.currentTemperatureTenthsCelsius = 124;
+  for (int hour = 0; hour < WeatherForecast::MAX_HOURLY_POINTS; hour++) {
+    forecast.hourlyTemperatureTenthsCelsius[hour] = 100 + (hour < 16 ? hour * 5 : (30 - hour) * 5);
+    forecast.hourlyWindSpeedTenthsMps[hour] = 30 + hour * 2;
+    forecast.hourlyWindGustsTenthsMps[hour] = 60 + hour * 5;
+    forecast.hourlyPrecipitationTenthsMm[hour] = hour >= 17 && hour <= 19 ? 14 : 0;
+  }
+  return forecast;
+}
+
+void setUp() { memset(sentence, 0, sizeof(sentence)); }
+
+void tearDown() {}
+
+void test_missing_forecast_says_so() {
+  WeatherForecast forecast;
+  memset(&forecast, 0, sizeof(forecast));
+  WeatherSentenceGenerator::generate(forecast, sentence, sizeof(sentence));
+  TEST_ASSERT_EQUAL_STRING("No weather data available right now.", sentence);
+}
+
+void test_rainy_afternoon_sentence() {
+  size_t length = WeatherSentenceGenerator::generate(rainyAfternoon(), sentence, sizeof(sentence));
+  TEST_ASSERT_EQUAL_STRING(
+      "This afternoon: 12°C and light rain, rising to 18°C by 15:00. Rain likely 17:00-20:00 (4.2 mm), gusts up to "
+      "18 m/s around 23:00.",
+      sentence);
+  TEST_ASSERT_EQUAL_size_t(strlen(sentence), length);
+}
+
+void test_dry_rest_of_evening() {
+  WeatherForecast forecast = rainyAfternoon();
+  forecast.currentLocalTime += 8 * 3600;
+  forecast.currentTemperatureTenthsCelsius = -31;
+  WeatherSentenceGenerator::generate(forecast, sentence, sizeof(sentence));
+  TEST_ASSERT_EQUAL_STRING(
+      "This evening: -3°C and light rain, rising to 14°C by 22:00. Dry for the rest of the day, gusts up to 18 m/s "
+      "around 23:00.",
+      sentence);
+}
+
+void test_partly_elapsed_hour_is_left_out_of_the_trend_and_rain_window() {
+  WeatherForecast forecast = rainyAfternoon();
+  forecast.currentLocalTime = JUNE_FIRST_2024 + 14 * 3600 + 20 * 60;
+  forecast.currentTemperatureTenthsCelsius = 150;
+  for (int hour = 0; hour < WeatherForecast::MAX_HOURLY_POINTS; hour++) {
+    forecast.hourlyTemperatureTenthsCelsius[hour] = hour == 14 ? 170 : 150;
+    forecast.hourlyPrecipitationTenthsMm[hour] = hour >= 14 && hour <= 15 ? 10 : 0;
+  }
+
+  WeatherSentenceGenerator::generate(forecast, sentence, sizeof(sentence));
+  TEST_ASSERT_EQUAL_STRING(
+      "This afternoon: 15°C and light rain, staying steady. Rain until 16:00 (2.0 mm), gusts up to 18 m/s around "
+      "23:00.",
+      sentence);
+}
+
+void test_sentence_is_truncated_to_the_buffer() {
+  char shortBuffer[20];
+  size_t length = WeatherSentenceGenerator::generate(rainyAfternoon(), shortBuffer, sizeof(shortBuffer));
+  TEST_ASSERT_EQUAL_size_t(sizeof(shortBuffer) - 1, length);
+  TEST_ASSERT_EQUAL_size_t(length, strlen(shortBuffer));
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_missing_forecast_says_so);
+  RUN_TEST(test_rainy_afternoon_sentence);
+  RUN_TEST(test_dry_rest_of_evening);
+  RUN_TEST(test_partly_elapsed_hour_is_left_out_of_the_trend_and_rain_window);
+  RUN_TEST(test_sentence_is_truncated_to_the_buffer);
+  return UNITY_END();
+}
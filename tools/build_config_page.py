@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""Compile web/config.html into src/config_page.h for ConfigPageStream.
+
+The page is split at its {{PLACEHOLDER}} markers. Each static chunk is raw-deflated and ends with a full flush, so it
+starts and ends on a byte boundary with no back-references into earlier chunks. The device can then insert each
+placeholder value as a stored deflate block and wrap the whole stream in a gzip header and trailer. The last chunk
+carries the final deflate block.
+
+Runs as a PlatformIO pre-build script (extra_scripts = pre:tools/build_config_page.py) or standalone.
+"""
+
+import os
+import re
+import zlib
+
+PLACEHOLDER = re.compile(rb"\{\{([A-Z0-9_]+)\}\}")
+BYTES_PER_LINE = 16
+
+
+def split_page(html):
+    chunks = []
+    placeholders = []
+    position = 0
+    for match in PLACEHOLDER.finditer(html):
+        chunks.append(html[position:match.start()])
+        placeholders.append(match.group(1).decode("ascii"))
+        position = match.end()
+    chunks.append(html[position:])
+    return chunks, placeholders
+
+
+def deflate_chunks(chunks):
+    compressor = zlib.compressobj(9, zlib.DEFLATED, -15, 9)
+    deflated = []
+    for index, chunk in enumerate(chunks):
+        is_last = index == len(chunks) - 1
+        deflated.append(compressor.compress(chunk) + compressor.flush(zlib.Z_FINISH if is_last else zlib.Z_FULL_FLUSH))
+    return deflated
+
+
+def format_bytes(data):
+    lines = []
+    for start in range(0, len(data), BYTES_PER_LINE):
+        lines.append("    " + " ".join("0x%02x," % b for b in data[start:start + BYTES_PER_LINE]))
+    return "\n".join(lines)
+
+
+def generate_header(html):
+    chunks, placeholders = split_page(html)
+    deflated = deflate_chunks(chunks)
+
+    out = [
+        "// Generated by tools/build_config_page.py from web/config.html, do not edit.",
+        "#pragma once",
+        "",
+        '#include "ConfigPageStream.h"',
+        "",
+    ]
+    for index, data in enumerate(deflated):
+        out.append("static const uint8_t CONFIG_PAGE_CHUNK_%d[] = {" % index)
+        out.append(format_bytes(data))
+        out.append("};")
+        out.append("")
+
+    out.append("static const ConfigPageChunk CONFIG_PAGE_CHUNKS[] = {")
+    for index, (chunk, data) in enumerate(zip(chunks, deflated)):
+        placeholder = '"%s"' % placeholders[index] if index < len(placeholders) else "nullptr"
+        out.append("    {CONFIG_PAGE_CHUNK_%d, %d, %d, 0x%08xu, %s}," %
+                   (index, len(data), len(chunk), zlib.crc32(chunk) & 0xFFFFFFFF, placeholder))
+    out.append("};")
+    out.append("")
+    out.append("static const size_t CONFIG_PAGE_CHUNK_COUNT = sizeof(CONFIG_PAGE_CHUNKS) / sizeof(ConfigPageChunk);")
+    out.append("")
+    return "\n".join(out), len(html), sum(len(d) for d in deflated)
+
+
+def build(project_dir):
+    source = os.path.join(project_dir, "web", "config.html")
+    target = os.path.join(project_dir, "src", "config_page.h")
+
+    with open(source, "rb") as f:
+        header, html_size, deflated_size = generate_header(f.read())
+
+    if os.path.exists(target):
+        with open(target, "r", encoding="ascii") as f:
+            if f.read() == header:
+                return
+
+    with open(target, "w", encoding="ascii", newline="\n") as f:
+        f.write(header)
+    print("config_page.h: %d bytes of HTML deflated to %d bytes" % (html_size, deflated_size))
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO
+    build(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        build(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""Encode an image as the packed 2-bpp format served to ImageScreen (application/x-grey2).
+
+Layout: "G2PK", width (u16 LE), height (u16 LE), version 1, encoding (0 raw, 1 PackBits), 2 reserved bytes,
+then top-down rows of (width + 3) // 4 bytes, four pixels per byte MSB first, level 0 black to 3 white.
+"""
+
+import argparse
+import struct
+
+from PIL import Image
+
+
+def dither_to_levels(image):
+    palette = Image.new("P", (1, 1))
+    palette.putpalette([v for level in range(4) for v in (level * 85,) * 3] + [0] * 3 * 252)
+    return image.convert("RGB").quantize(palette=palette, dither=Image.Dither.FLOYDSTEINBERG)
+
+
+def pack_rows(levels):
+    width, height = levels.size
+    pixels = levels.load()
+    rows = bytearray()
+    for y in range(height):
+        for x in range(0, width, 4):
+            byte = 0
+            for i in range(4):
+                level = pixels[x + i, y] if x + i < width else 0
+                byte |= level << (6 - i * 2)
+            rows.append(byte)
+    return bytes(rows)
+
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run > 1:
+            out += bytes([257 - run, data[i]])
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < 128 and (i + 1 >= len(data) or data[i + 1] != data[i]):
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def unpackbits(data, length):
+    out = bytearray()
+    i = 0
+    while len(out) < length:
+        control = data[i]
+        i += 1
+        if control < 128:
+            out += data[i:i + control + 1]
+            i += control + 1
+        elif control > 128:
+            out += bytes([data[i]]) * (257 - control)
+            i += 1
+    return bytes(out)
+
+
+def encode(image, use_packbits):
+    rows = pack_rows(dither_to_levels(image))
+    body = packbits(rows) if use_packbits else rows
+    if use_packbits:
+        assert unpackbits(body, len(rows)) == rows
+    header = b"G2PK" + struct.pack("<HHBBH", image.width, image.height, 1, 1 if use_packbits else 0, 0)
+    return header + body
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input")
+    parser.add_argument("output")
+    parser.add_argument("--size", default="250x122", help="panel size as WIDTHxHEIGHT")
+    parser.add_argument("--raw", action="store_true", help="write uncompressed rows instead of PackBits")
+    args = parser.parse_args()
+
+    width, height = (int(v) for v in args.size.split("x"))
+    image = Image.open(args.input)
+    image.thumbnail((width, height))
+    with open(args.output, "wb") as f:
+        f.write(encode(image, not args.raw))
+
+
+if __name__ == "__main__":
+    main()